@@ -0,0 +1,31 @@
+# Counts integer divisions in a library: hardware divide instructions and calls
+# to the compiler's software division helpers. Fails if it finds any. Run in
+# script mode:
+#
+#   cmake -DOBJDUMP=objdump -DLIBRARY=libleapc.a -P LeapNoDivide.cmake
+#
+# Disassembles with relocations so that calls from unlinked objects still name
+# their targets. Matches x86 div and idiv, ARM sdiv and udiv, the ARM EABI
+# __aeabi_idiv family and the libgcc __divsi3 family.
+execute_process (COMMAND ${OBJDUMP} -dr ${LIBRARY}
+    OUTPUT_FILE ${CMAKE_CURRENT_BINARY_DIR}/leap_no_divide.dump
+    RESULT_VARIABLE result
+)
+if (NOT result EQUAL 0)
+    message (FATAL_ERROR "${OBJDUMP} failed on ${LIBRARY}")
+endif ()
+file (STRINGS ${CMAKE_CURRENT_BINARY_DIR}/leap_no_divide.dump lines)
+set (count 0)
+set (function "")
+foreach (line IN LISTS lines)
+    if (line MATCHES "^[0-9a-f]+ <([^>]+)>:$")
+        set (function ${CMAKE_MATCH_1})
+    elseif (line MATCHES "[ \t](i|s|u)?div[bwlq]?[ \t]" OR line MATCHES "__aeabi_u?[il]div|__u?(div|mod)[sdt]i3")
+        math (EXPR count "${count} + 1")
+        message ("${function}: ${line}")
+    endif ()
+endforeach ()
+message ("${count} divisions in ${LIBRARY}")
+if (count GREATER 0)
+    message (FATAL_ERROR "Divisions remain")
+endif ()
@@ -0,0 +1,271 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_fuzz.c
+ * \brief Differential fuzz target comparing leapc with the C library.
+ * \details Feeds arbitrary (year, month, day) and day-offset values into
+ * leap_from(), leap_off(), leap_date(), leap_abs_date() and leap_abs_from().
+ * Compares the answers with the C library's timegm() and gmtime_r() wherever
+ * a 64-bit \c time_t can represent them; checks internal invariants always.
+ * Compares leap_gmtime_r() and leap_timegm() with their C library originals.
+ *
+ * Raw input integers fold into the safe integer range since leapc by design
+ * overflows beyond LEAP_YEAR_MIN through LEAP_YEAR_MAX. Months and days fold
+ * into spans of about a thousand years either side so that normalisation
+ * exercises carries in both directions.
+ *
+ * Builds three ways:
+ *  - with \c LEAPC_LIBFUZZER defined, as a libFuzzer target;
+ *  - otherwise, with its own \c main for AFL, reading one input from each
+ *    file argument or from standard input;
+ *  - or, given <tt>-r count</tt>, as a smoke test running a fixed sequence of
+ *    pseudo-random inputs.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#define _DEFAULT_SOURCE
+
+#include "leap.h"
+#include "leap_tm.h"
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*!
+ * \brief Bytes of input consumed per run.
+ * \details Four 32-bit integers: year, month, day and day offset. Shorter
+ * inputs pad with zeros.
+ */
+#define INPUT_SIZE 16
+
+/*!
+ * \brief Years of leeway either side for month and day normalisation.
+ */
+#define SPAN_YEARS 1000
+
+#define FAIL(...)                                                                                                      \
+  do {                                                                                                                 \
+    (void)fprintf(stderr, __VA_ARGS__);                                                                                \
+    (void)fputc('\n', stderr);                                                                                         \
+    abort();                                                                                                           \
+  } while (0)
+
+/*!
+ * \brief Folds a raw integer into an inclusive range.
+ * \details Uses 64-bit arithmetic so that folding never overflows.
+ */
+static int fold(int32_t raw, int lo, int hi) {
+  const int64_t span = (int64_t)hi - lo + 1;
+  int64_t mod = (int64_t)raw % span;
+  if (mod < 0) {
+    mod += span;
+  }
+  return (int)(lo + mod);
+}
+
+/*!
+ * \brief Unix day from year, month and day using the C library.
+ * \details Lets timegm() normalise out-of-range months and days.
+ */
+static int64_t libc_days(int year, int month, int day) {
+  struct tm tm;
+  (void)memset(&tm, 0, sizeof(tm));
+  tm.tm_year = year - 1900;
+  tm.tm_mon = month - 1;
+  tm.tm_mday = day;
+  const time_t t = timegm(&tm);
+  return (int64_t)t / 86400;
+}
+
+/*!
+ * \brief Date and day of year from absolute day using the C library.
+ * \returns False if gmtime_r() cannot represent the day.
+ */
+static bool libc_date(int day_off, struct leap_date *date, int *yday) {
+  const time_t t = (time_t)((int64_t)day_off - LEAP_MCMLXX) * 86400;
+  struct tm tm;
+  if (gmtime_r(&t, &tm) == NULL) {
+    return false;
+  }
+  *date = (struct leap_date){tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday};
+  *yday = tm.tm_yday;
+  return true;
+}
+
+/*!
+ * \brief Checks an absolute day against its date.
+ * \details Checks the date's bounds and round trip, then compares with the C
+ * library.
+ */
+static void check_abs(const char *what, int abs, struct leap_date date) {
+  if (date.month < 1 || date.month > 12 || date.day < 1 || date.day > leap_mday(date.year, date.month)) {
+    FAIL("%s: day %d: %d-%d-%d out of bounds", what, abs, date.year, date.month, date.day);
+  }
+  if (leap_abs_from_date(date) != abs) {
+    FAIL("%s: day %d: %d-%d-%d round trips to %d", what, abs, date.year, date.month, date.day,
+         leap_abs_from_date(date));
+  }
+  if (sizeof(time_t) < sizeof(int64_t)) {
+    return;
+  }
+  struct leap_date libc;
+  int yday;
+  if (libc_date(abs, &libc, &yday)) {
+    if (!equal_leap_date(libc, date)) {
+      FAIL("%s: day %d: %d-%d-%d but gmtime_r gives %d-%d-%d", what, abs, date.year, date.month, date.day, libc.year,
+           libc.month, libc.day);
+    }
+    if (yday != abs - leap_day(date.year)) {
+      FAIL("%s: day %d: day of year %d but gmtime_r gives %d", what, abs, abs - leap_day(date.year), yday);
+    }
+  }
+}
+
+/*!
+ * \brief Checks the broken-down time replacements against the C library.
+ * \param t Calendar time.
+ * \param mon Unnormalised month, zero-based.
+ * \param mday Unnormalised day of the month.
+ */
+static void check_tm(time_t t, int mon, int mday) {
+  struct tm libc, leap;
+  if (gmtime_r(&t, &libc) == NULL) {
+    return;
+  }
+  if (leap_gmtime_r(&t, &leap) == NULL || memcmp(&libc, &leap, offsetof(struct tm, tm_isdst)) != 0) {
+    FAIL("leap_gmtime_r(%lld) disagrees with gmtime_r", (long long)t);
+  }
+  libc.tm_mon = leap.tm_mon = mon;
+  libc.tm_mday = leap.tm_mday = mday;
+  const time_t libc_t = timegm(&libc);
+  errno = 0;
+  const time_t leap_t = leap_timegm(&leap);
+  if (leap_t == (time_t)-1 && errno == EOVERFLOW) {
+    /*
+     * The normalised time lies beyond the safe range of years. The C library
+     * goes further.
+     */
+    const long long year = libc.tm_year + 1900LL;
+    if (year >= LEAP_YEAR_MIN && year <= LEAP_YEAR_MAX) {
+      FAIL("leap_timegm() overflows at year %lld", year);
+    }
+    return;
+  }
+  if (libc_t != leap_t || memcmp(&libc, &leap, offsetof(struct tm, tm_isdst)) != 0) {
+    FAIL("leap_timegm() gives %lld but timegm gives %lld", (long long)leap_t, (long long)libc_t);
+  }
+}
+
+static void fuzz(int32_t raw_year, int32_t raw_month, int32_t raw_day, int32_t raw_off) {
+  const int year = fold(raw_year, LEAP_YEAR_MIN + SPAN_YEARS, LEAP_YEAR_MAX - SPAN_YEARS);
+  const int month = fold(raw_month, -12 * SPAN_YEARS, 12 * SPAN_YEARS);
+  const int day = fold(raw_day, -366 * SPAN_YEARS, 366 * SPAN_YEARS);
+  const int abs_off = fold(raw_off, LEAP_ABS_MIN, LEAP_ABS_MAX);
+
+  /*
+   * leap_from() and leap_abs_from() normalise months then days.
+   */
+  const struct leap_off from = leap_from(year, month, day);
+  if (from.day < 0 || from.day >= 365 + leap_add(from.year)) {
+    FAIL("leap_from(%d, %d, %d): day of year %d out of bounds", year, month, day, from.day);
+  }
+  const int abs = leap_abs_from(year, month, day);
+  if (abs != leap_day(from.year) + from.day) {
+    FAIL("leap_abs_from(%d, %d, %d): %d disagrees with leap_from()", year, month, day, abs);
+  }
+  if (sizeof(time_t) >= sizeof(int64_t) && libc_days(year, month, day) != (int64_t)abs - LEAP_MCMLXX) {
+    FAIL("leap_abs_from(%d, %d, %d): %d but timegm gives %lld", year, month, day, abs - LEAP_MCMLXX,
+         (long long)libc_days(year, month, day));
+  }
+  check_abs("leap_abs_date", abs, leap_abs_date(abs));
+
+  /*
+   * leap_off() and leap_date() normalise a day offset relative to a year.
+   */
+  const int off_abs = leap_day(year) + day;
+  const struct leap_off off = leap_off(year, day);
+  if (off.day < 0 || off.day >= 365 + leap_add(off.year) || leap_day(off.year) + off.day != off_abs) {
+    FAIL("leap_off(%d, %d): gives (%d, %d)", year, day, off.year, off.day);
+  }
+  const struct leap_date date = leap_date(year, day);
+  if (date.year != off.year) {
+    FAIL("leap_date(%d, %d): year %d disagrees with leap_off()", year, day, date.year);
+  }
+  check_abs("leap_date", off_abs, date);
+
+  /*
+   * leap_abs_date() over the full safe range.
+   */
+  check_abs("leap_abs_date", abs_off, leap_abs_date(abs_off));
+
+  /*
+   * leap_gmtime_r() and leap_timegm() at some second of the day.
+   */
+  if (sizeof(time_t) >= sizeof(int64_t)) {
+    const int sod = fold(raw_day, 0, 86399);
+    check_tm((time_t)(((int64_t)abs_off - LEAP_MCMLXX) * 86400 + sod), month, day);
+  }
+}
+
+static int32_t get32(const uint8_t *data) {
+  return (int32_t)((uint32_t)data[0] | (uint32_t)data[1] << 8 | (uint32_t)data[2] << 16 | (uint32_t)data[3] << 24);
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+  uint8_t input[INPUT_SIZE] = {0};
+  (void)memcpy(input, data, size < INPUT_SIZE ? size : INPUT_SIZE);
+  fuzz(get32(input), get32(input + 4), get32(input + 8), get32(input + 12));
+  return 0;
+}
+
+#ifndef LEAPC_LIBFUZZER
+
+static int run_file(FILE *file) {
+  uint8_t data[INPUT_SIZE];
+  const size_t size = fread(data, 1, sizeof(data), file);
+  return LLVMFuzzerTestOneInput(data, size);
+}
+
+/*!
+ * \brief Runs pseudo-random inputs.
+ * \details Uses a fixed-seed xorshift generator so that failures reproduce.
+ */
+static void run_random(long count) {
+  uint32_t x = 2463534242u;
+  for (long i = 0; i < count; ++i) {
+    int32_t raw[4];
+    for (int j = 0; j < 4; ++j) {
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      raw[j] = (int32_t)x;
+    }
+    fuzz(raw[0], raw[1], raw[2], raw[3]);
+  }
+}
+
+int main(int argc, char **argv) {
+  if (argc == 3 && strcmp(argv[1], "-r") == 0) {
+    run_random(strtol(argv[2], NULL, 10));
+    return EXIT_SUCCESS;
+  }
+  if (argc == 1) {
+    return run_file(stdin);
+  }
+  for (int i = 1; i < argc; ++i) {
+    FILE *file = fopen(argv[i], "rb");
+    if (file == NULL) {
+      perror(argv[i]);
+      return EXIT_FAILURE;
+    }
+    (void)run_file(file);
+    (void)fclose(file);
+  }
+  return EXIT_SUCCESS;
+}
+
+#endif /* LEAPC_LIBFUZZER */
@@ -18,6 +18,40 @@
  */
 #define LEAP_MCM 693961
 
+/*!
+ * \brief Leap offset at 1970.
+ * \details MCMLXX is Roman numerals for 1970, the Unix epoch. Subtract from an
+ * absolute day to answer days since 1970-01-01.
+ */
+#define LEAP_MCMLXX 719528
+
+/*!
+ * \brief Earliest year within the safe integer range.
+ * \details Years from LEAP_YEAR_MIN through LEAP_YEAR_MAX inclusive convert to
+ * and from absolute days without overflowing a 32-bit \c int anywhere in the
+ * library, leaving headroom for offsets of a few hundred years either side.
+ */
+#define LEAP_YEAR_MIN (-5000000)
+
+/*!
+ * \brief Latest year within the safe integer range.
+ * \see LEAP_YEAR_MIN
+ */
+#define LEAP_YEAR_MAX 5000000
+
+/*!
+ * \brief Earliest absolute day within the safe integer range.
+ * \details First day of LEAP_YEAR_MIN, that is, \c leap_day(LEAP_YEAR_MIN).
+ */
+#define LEAP_ABS_MIN (-1826212500)
+
+/*!
+ * \brief Latest absolute day within the safe integer range.
+ * \details Last day of LEAP_YEAR_MAX, that is, one day before
+ * \c leap_day(LEAP_YEAR_MAX + 1).
+ */
+#define LEAP_ABS_MAX 1826212865
+
 /*!
  * \brief Determine if a year is a leap year.
  * \details Is a year a leap year? A year is a leap year if it is divisible by
@@ -274,4 +308,50 @@ int leap_abs_from(int year, int month, int day);
  */
 static inline int leap_abs_from_date(struct leap_date date) { return leap_abs_from(date.year, date.month, date.day); }
 
+/*!
+ * \brief Year from absolute day.
+ * \details Decodes the year alone, stopping before the month and day of month.
+ * Always agrees with the year of leap_abs_date().
+ * \param day_off The absolute day offset, starting from 0 for the first day of
+ * year 0.
+ * \returns The year.
+ */
+int leap_abs_year(int day_off);
+
+/*!
+ * \brief Year and month.
+ * \details Represents a calendar month of some year: a date without its day.
+ */
+struct leap_year_month {
+  /*!
+   * \brief Year.
+   */
+  int year;
+  /*!
+   * \brief Month of year starting from 1 for January.
+   */
+  int month;
+};
+
+/*!
+ * \brief Compares two leap_year_month structures for equality.
+ * \param lhs The first leap_year_month structure.
+ * \param rhs The second leap_year_month structure.
+ * \retval true if both structures represent the same month.
+ * \retval false otherwise.
+ */
+static inline bool equal_leap_year_month(struct leap_year_month lhs, struct leap_year_month rhs) {
+  return lhs.year == rhs.year && lhs.month == rhs.month;
+}
+
+/*!
+ * \brief Year and month from absolute day.
+ * \details Decodes the year and month, stopping before the day of month.
+ * Always agrees with the year and month of leap_abs_date().
+ * \param day_off The absolute day offset, starting from 0 for the first day of
+ * year 0.
+ * \returns The year and month.
+ */
+struct leap_year_month leap_abs_year_month(int day_off);
+
 #endif /* __LEAP_H__ */
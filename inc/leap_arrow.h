@@ -0,0 +1,109 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_arrow.h
+ * \brief Apache Arrow adapter prototypes.
+ * \details Converts Arrow date and timestamp arrays to calendar field arrays
+ * and back through the Arrow C data interface. The interface is an ABI, two
+ * structures and their conventions, so the adapters need no Arrow library:
+ * this header declares the structures itself, guarded as the interface
+ * specifies so that it coexists with Arrow's own headers.
+ *
+ * The adapters read input buffers in place, honouring the array offset, and
+ * allocate each output array's buffers in one 64-byte aligned block, freed once
+ * the array and any children moved out of it are all released. Arrow's date32
+ * counts days since 1970, so absolute days differ from it by LEAP_MCMLXX; the
+ * other types divide down to such days first. Fields are those of Coordinated
+ * Universal Time whatever a timestamp's time zone, since Arrow stores
+ * timestamps as UTC instants.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#ifndef __LEAP_ARROW_H__
+#define __LEAP_ARROW_H__
+
+#include <stdint.h>
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+/*!
+ * \brief Arrow C data interface schema.
+ */
+struct ArrowSchema {
+  const char *format;
+  const char *name;
+  const char *metadata;
+  int64_t flags;
+  int64_t n_children;
+  struct ArrowSchema **children;
+  struct ArrowSchema *dictionary;
+  void (*release)(struct ArrowSchema *);
+  void *private_data;
+};
+
+/*!
+ * \brief Arrow C data interface array.
+ */
+struct ArrowArray {
+  int64_t length;
+  int64_t null_count;
+  int64_t offset;
+  int64_t n_buffers;
+  int64_t n_children;
+  const void **buffers;
+  struct ArrowArray **children;
+  struct ArrowArray *dictionary;
+  void (*release)(struct ArrowArray *);
+  void *private_data;
+};
+
+#endif /* ARROW_C_DATA_INTERFACE */
+
+/*!
+ * \brief Arrow date and timestamp array to calendar fields.
+ * \details Accepts date32 (\c tdD), date64 (\c tdm) and timestamps in
+ * seconds, milliseconds, microseconds or nanoseconds (\c tss:, \c tsm:,
+ * \c tsu: and \c tsn:, with any time zone). Exports a struct array (\c +s)
+ * of four int32 children: \c year, \c month, \c day and \c weekday, the last
+ * 0 for Sunday through 6 for Saturday. The children share one copy of the
+ * input's validity bitmap; null slots hold zeros.
+ *
+ * Releasing the exported array releases the children still attached to it.
+ * Children moved out may be released later, in any order; the shared
+ * allocation goes with the last release.
+ * \param schema Input schema.
+ * \param array Input array.
+ * \param out_schema Exported schema on success.
+ * \param out_array Exported array on success.
+ * \retval 0 on success.
+ * \retval EINVAL if the input is not a supported type.
+ * \retval EOVERFLOW if a valid input falls outside the safe integer range.
+ * \retval ENOMEM if allocation fails.
+ */
+int leap_arrow_fields(const struct ArrowSchema *schema, const struct ArrowArray *array,
+                      struct ArrowSchema *out_schema, struct ArrowArray *out_array);
+
+/*!
+ * \brief Calendar fields to an Arrow date array.
+ * \details Accepts a struct array (\c +s) whose first three children are
+ * int32 (\c i) years, months and days, such as leap_arrow_fields() exports;
+ * ignores any further children. Exports a date32 or date64 array. Slots null
+ * in the struct or in any of the three children, and slots holding invalid
+ * dates, come out null.
+ * \param schema Input schema.
+ * \param array Input array.
+ * \param format Output format, \c tdD for date32 or \c tdm for date64.
+ * \param out_schema Exported schema on success.
+ * \param out_array Exported array on success.
+ * \retval 0 on success.
+ * \retval EINVAL if the input or the format is not supported.
+ * \retval ENOMEM if allocation fails.
+ */
+int leap_arrow_dates(const struct ArrowSchema *schema, const struct ArrowArray *array, const char *format,
+                     struct ArrowSchema *out_schema, struct ArrowArray *out_array);
+
+#endif /* __LEAP_ARROW_H__ */
@@ -0,0 +1,88 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_day16.h
+ * \brief Sixteen-bit day offset prototypes.
+ * \details Encodes days as unsigned 16-bit offsets from the first of January
+ * of an epoch year fixed at compile time: 65536 days, a little over 179 years.
+ * Records that carry a date in two bytes rather than four suit flash-based
+ * data loggers.
+ *
+ * The epoch year defaults to 2000; define \c LEAPC_DAY16_EPOCH to move it. The
+ * library and its callers must agree, so the build defines it for both.
+ * Decoding to dates looks up the year in a table of the window's year starts
+ * rather than dividing through the 400-year cycle.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#ifndef __LEAP_DAY16_H__
+#define __LEAP_DAY16_H__
+
+#include "leap.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef LEAPC_DAY16_EPOCH
+#define LEAPC_DAY16_EPOCH 2000
+#endif
+
+#if LEAPC_DAY16_EPOCH < 0 || LEAPC_DAY16_EPOCH > LEAP_YEAR_MAX - 180
+#error LEAPC_DAY16_EPOCH out of range
+#endif
+
+/*!
+ * \brief Absolute day of the first of January, for years 0 and later, as a
+ * constant expression.
+ * \details Equals leap_day() for the same year. Rounding the quotients up
+ * counts the leap years before the year plus one for each term.
+ */
+#define LEAP_DAY16_DAY(year) ((year) * 365 + ((year) + 3) / 4 - ((year) + 99) / 100 + ((year) + 399) / 400)
+
+/*!
+ * \brief Absolute day of offset zero.
+ */
+#define LEAP_DAY16_EPOCH LEAP_DAY16_DAY(LEAPC_DAY16_EPOCH)
+
+/*!
+ * \brief Years that start within the window.
+ */
+#define LEAP_DAY16_YEARS 180
+
+/*!
+ * \brief Absolute day from a 16-bit offset.
+ * \param day16 Days since the epoch.
+ * \returns Absolute day.
+ */
+static inline int leap_day16_abs(uint16_t day16) { return LEAP_DAY16_EPOCH + day16; }
+
+/*!
+ * \brief Encodes an absolute day as a 16-bit offset.
+ * \param abs_day Absolute day.
+ * \param day16 Days since the epoch on success.
+ * \retval true if the day falls within 65536 days from the epoch.
+ * \retval false otherwise, leaving \c day16 alone.
+ */
+bool leap_day16_encode(int abs_day, uint16_t *day16);
+
+/*!
+ * \brief Encodes a date as a 16-bit offset.
+ * \details Finds the first of January in the table, then adds the days before
+ * the month and the day of the month.
+ * \param date Valid date.
+ * \param day16 Days since the epoch on success.
+ * \retval true if the date falls within 65536 days from the epoch.
+ * \retval false otherwise, leaving \c day16 alone.
+ */
+bool leap_day16_from_date(struct leap_date date, uint16_t *day16);
+
+/*!
+ * \brief Decodes a 16-bit offset to a date.
+ * \details Estimates the year by dividing by 365, which overshoots by at most
+ * one year across the window, then corrects against the table. Months and days
+ * follow from the day of the year by reciprocal multiplication.
+ * \param day16 Days since the epoch.
+ * \returns Date.
+ */
+struct leap_date leap_day16_date(uint16_t day16);
+
+#endif /* __LEAP_DAY16_H__ */
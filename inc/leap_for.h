@@ -0,0 +1,88 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_for.h
+ * \brief Day column compression prototypes.
+ * \details Compresses columns of absolute days by frame of reference and bit
+ * packing. Splits the column into blocks of LEAP_FOR_BLOCK days. Each block
+ * stores its smallest and largest day and packs either every day less the
+ * smallest or, when the block runs in ascending order, every difference from
+ * the day before, whichever needs fewer bits. A partition of sorted dates a
+ * few thousand days wide packs into a few bits per day.
+ *
+ * Compressed columns are arrays of 32-bit words: one word for the number of
+ * days, then the blocks, each three header words and its packed bits in four
+ * interleaved lanes, the layout that lets unpacking vectorise.
+ * Decoders unpack a block at a time into a small buffer, then finish every day
+ * of the block, to absolute days or to dates, in the same pass.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#ifndef __LEAP_FOR_H__
+#define __LEAP_FOR_H__
+
+#include "leap.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*!
+ * \brief Days per block.
+ */
+#define LEAP_FOR_BLOCK 128
+
+/*!
+ * \brief Most words that compressing \c n days takes.
+ * \details One word for the count, then for every block three header words,
+ * one word per day at the widest and four words of padding.
+ */
+#define LEAP_FOR_WORDS(n) (1 + (((size_t)(n) + LEAP_FOR_BLOCK - 1) >> 7) * (LEAP_FOR_BLOCK + 7))
+
+/*!
+ * \brief Compresses a column of absolute days.
+ * \details Compresses any column; ascending columns compress best.
+ * \param abs_day Absolute days, \c n of them.
+ * \param n Number of days, less than \f$2^{32}\f$.
+ * \param out Compressed column, with room for LEAP_FOR_WORDS(n) words.
+ * \returns Number of words written.
+ */
+size_t leap_for_encode(const int *abs_day, size_t n, uint32_t *out);
+
+/*!
+ * \brief Number of days in a compressed column.
+ * \param in Compressed column.
+ * \returns Number of days.
+ */
+size_t leap_for_count(const uint32_t *in);
+
+/*!
+ * \brief Decompresses a column to absolute days.
+ * \param in Compressed column.
+ * \param abs_day Absolute days, with room for leap_for_count() of them.
+ */
+void leap_for_decode(const uint32_t *in, int *abs_day);
+
+/*!
+ * \brief Decompresses a column straight to dates.
+ * \details Decodes each day to its date as it unpacks, without an
+ * intermediate column of absolute days.
+ * \param in Compressed column of days within the safe integer range.
+ * \param date Dates, with room for leap_for_count() of them.
+ */
+void leap_for_decode_date(const uint32_t *in, struct leap_date *date);
+
+/*!
+ * \brief Run lengths of calendar months in a compressed column.
+ * \details Counts consecutive days falling in the same month. Skips unpacking
+ * any block whose smallest and largest days share a month, counting the whole
+ * block at once; otherwise decodes dates only where a run changes month.
+ * Writes at most \c max runs but answers the number of runs in the column,
+ * which may be more.
+ * \param in Compressed column of days within the safe integer range.
+ * \param month Months of the runs, with room for \c max of them.
+ * \param count Days in the runs, with room for \c max of them.
+ * \param max Most runs to write.
+ * \returns Number of runs in the column.
+ */
+size_t leap_for_month_runs(const uint32_t *in, struct leap_year_month *month, size_t *count, size_t max);
+
+#endif /* __LEAP_FOR_H__ */
@@ -0,0 +1,340 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_format.h
+ * \brief Compiled date format prototypes.
+ * \details Compiles strptime-style format strings, such as "%d/%m/%Y",
+ * "%b %d %Y" or "%Y%j", once into compact programs, then runs the programs over
+ * any number of inputs without interpreting the format string again. The same
+ * programs format in the strftime style.
+ *
+ * Formats understand these conversions:
+ *  - \c %%Y year, up to four digits;
+ *  - \c %%y year of the century, up to two digits: 69 through 99 fall in the
+ *    1900s, 00 through 68 in the 2000s;
+ *  - \c %%m month, up to two digits;
+ *  - \c %%d and \c %%e day of the month, up to two digits after optional
+ *    spaces;
+ *  - \c %%j day of the year, up to three digits;
+ *  - \c %%b, \c %%h and \c %%B English month name, abbreviated or full, in any
+ *    letter case;
+ *  - \c %%a and \c %%A English weekday name, abbreviated or full;
+ *  - \c %%H, \c %%M and \c %%S hour, minute and second, up to two digits;
+ *  - \c %%%% a percent sign.
+ *
+ * White space in the format matches zero or more spaces or tabs; every other
+ * character matches itself. Month and weekday names match the C locale's
+ * English names whatever the current locale. Parsing checks the weekday name
+ * and the time of day for form and range only; they take no part in the date.
+ *
+ * Formatting writes numbers zero-padded to their full width, except \c %%e
+ * which pads with a space, and names capitalised. Years run from 0000 through
+ * 9999. White space writes itself.
+ *
+ * Fixed ISO 8601 layouts need no program. They write straight into caller
+ * buffers two digits at a time from a table of digit pairs: no \c printf and
+ * no locale.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#ifndef __LEAP_FORMAT_H__
+#define __LEAP_FORMAT_H__
+
+#include "leap.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*!
+ * \brief Most operations in one compiled format.
+ */
+#define LEAP_FORMAT_OPS 32
+
+/*!
+ * \brief Compiled format operation codes.
+ */
+enum leap_format_op {
+  /*!
+   * \brief Matches one literal character.
+   */
+  LEAP_FORMAT_LIT,
+  /*!
+   * \brief Matches any run of spaces and tabs; writes one space or tab.
+   */
+  LEAP_FORMAT_SPACE,
+  /*!
+   * \brief Year, \c %%Y.
+   */
+  LEAP_FORMAT_YEAR,
+  /*!
+   * \brief Year of the century, \c %%y.
+   */
+  LEAP_FORMAT_YEAR2,
+  /*!
+   * \brief Month, \c %%m.
+   */
+  LEAP_FORMAT_MONTH,
+  /*!
+   * \brief Day of the month, \c %%d or \c %%e.
+   */
+  LEAP_FORMAT_MDAY,
+  /*!
+   * \brief Day of the year, \c %%j.
+   */
+  LEAP_FORMAT_YDAY,
+  /*!
+   * \brief Month name, \c %%b, \c %%h or \c %%B.
+   */
+  LEAP_FORMAT_MON_NAME,
+  /*!
+   * \brief Weekday name, \c %%a or \c %%A.
+   */
+  LEAP_FORMAT_WDAY_NAME,
+  /*!
+   * \brief Hour, \c %%H.
+   */
+  LEAP_FORMAT_HOUR,
+  /*!
+   * \brief Minute, \c %%M.
+   */
+  LEAP_FORMAT_MIN,
+  /*!
+   * \brief Second, \c %%S.
+   */
+  LEAP_FORMAT_SEC,
+};
+
+/*!
+ * \brief Compiled format.
+ * \details Holds the format as a sequence of operations, each an operation
+ * code and a character: the literal to match for literals, the conversion
+ * letter for conversions. Copy it freely; it points to nothing.
+ */
+struct leap_format {
+  /*!
+   * \brief Number of operations.
+   */
+  int n;
+  /*!
+   * \brief Operation codes, from enum leap_format_op.
+   */
+  uint8_t op[LEAP_FORMAT_OPS];
+  /*!
+   * \brief Literal characters or conversion letters, one per operation.
+   */
+  char ch[LEAP_FORMAT_OPS];
+};
+
+/*!
+ * \brief Compiles a format string.
+ * \param format Compiled format to fill.
+ * \param spec Null-terminated format string.
+ * \retval true if the format compiled.
+ * \retval false if it holds an unknown conversion or more than
+ * LEAP_FORMAT_OPS operations.
+ */
+bool leap_format_compile(struct leap_format *format, const char *spec);
+
+/*!
+ * \brief Parses a date with a compiled format.
+ * \details Matches the whole text. Without a month, the date falls in January;
+ * without a day of the month, on the first. A day of the year overrides any
+ * month and day of the month. Validates the month and the day against its
+ * month or year.
+ * \param format Compiled format.
+ * \param text Characters to parse.
+ * \param len Number of characters.
+ * \param date Date on success.
+ * \retval true if the format matched the whole text and made a valid date.
+ * \retval false otherwise, leaving \c date alone.
+ */
+bool leap_parse_compiled(const struct leap_format *format, const char *text, size_t len, struct leap_date *date);
+
+/*!
+ * \brief Batch parses dates with a compiled format.
+ * \details Parses \c n fields, each given by its first character and its
+ * length, to absolute days. Marks invalid fields in a bitmap as
+ * leap_parse_iso_date_n() does, answering absolute day 0 for them.
+ * \param format Compiled format.
+ * \param text First characters of the fields, \c n of them.
+ * \param len Lengths of the fields, \c n of them.
+ * \param n Number of fields.
+ * \param abs_day Absolute days, with room for \c n of them.
+ * \param invalid Bitmap of invalid fields, with room for <tt>(n + 63) / 64</tt>
+ * words.
+ * \returns Number of invalid fields.
+ */
+size_t leap_parse_compiled_n(const struct leap_format *format, const char *const *text, const size_t *len, size_t n,
+                             int *abs_day, uint64_t *invalid);
+
+/*!
+ * \brief Last absolute day with a four-digit year, 9999-12-31.
+ * \details The ISO 8601 formatters cover absolute days 0 through this, and
+ * saturate anything beyond to the first or last instant of the range.
+ */
+#define LEAP_FORMAT_ABS_MAX 3652424
+
+/*!
+ * \brief Characters in an ISO 8601 date, YYYY-MM-DD.
+ */
+#define LEAP_FORMAT_ISO 10
+
+/*!
+ * \brief Characters in an ISO 8601 timestamp in seconds,
+ * YYYY-MM-DDTHH:MM:SSZ.
+ */
+#define LEAP_FORMAT_ISO_TIME 20
+
+/*!
+ * \brief Characters in an ISO 8601 timestamp in nanoseconds,
+ * YYYY-MM-DDTHH:MM:SS.NNNNNNNNNZ.
+ */
+#define LEAP_FORMAT_ISO_TIME_NS 30
+
+/*!
+ * \brief Formats an ISO 8601 date.
+ * \details Writes exactly LEAP_FORMAT_ISO characters and no terminator.
+ * \param abs_day Absolute day, saturating outside years 0000 through 9999.
+ * \param out Buffer for the characters.
+ */
+void leap_format_iso(int abs_day, char out[LEAP_FORMAT_ISO]);
+
+/*!
+ * \brief Formats an ISO 8601 timestamp from seconds.
+ * \details Writes exactly LEAP_FORMAT_ISO_TIME characters and no terminator,
+ * in Coordinated Universal Time.
+ * \param sec Seconds since the epoch, saturating outside years 0000 through
+ * 9999.
+ * \param epoch Absolute day of the epoch, for example LEAP_MCMLXX.
+ * \param out Buffer for the characters.
+ */
+void leap_format_iso_time(int64_t sec, int epoch, char out[LEAP_FORMAT_ISO_TIME]);
+
+/*!
+ * \brief Formats an ISO 8601 timestamp from nanoseconds.
+ * \details Writes exactly LEAP_FORMAT_ISO_TIME_NS characters and no
+ * terminator, always with nine fractional digits.
+ * \param ns Nanoseconds since the epoch, saturating outside years 0000
+ * through 9999.
+ * \param epoch Absolute day of the epoch.
+ * \param out Buffer for the characters.
+ */
+void leap_format_iso_time_ns(int64_t ns, int epoch, char out[LEAP_FORMAT_ISO_TIME_NS]);
+
+/*!
+ * \brief Batch formats ISO 8601 dates.
+ * \details Writes \c n dates, the first at \c out and each following
+ * \c stride characters after the one before. Leaves any characters between
+ * dates alone, so that the buffer can carry its own delimiters.
+ * \param abs_day Absolute days, \c n of them.
+ * \param n Number of days.
+ * \param out Buffer with room for \c n strides.
+ * \param stride Characters from one date to the next, at least LEAP_FORMAT_ISO.
+ * \returns Number of days saturated to years 0000 through 9999.
+ */
+size_t leap_format_iso_n(const int *abs_day, size_t n, char *out, size_t stride);
+
+/*!
+ * \brief Batch formats ISO 8601 timestamps from nanoseconds.
+ * \details Writes \c n timestamps at a fixed stride as leap_format_iso_n()
+ * does.
+ * \param ns Nanoseconds since the epoch, \c n of them.
+ * \param n Number of timestamps.
+ * \param epoch Absolute day of the epoch.
+ * \param out Buffer with room for \c n strides.
+ * \param stride Characters from one timestamp to the next, at least
+ * LEAP_FORMAT_ISO_TIME_NS.
+ * \returns Number of timestamps saturated to years 0000 through 9999.
+ */
+size_t leap_format_iso_time_ns_n(const int64_t *ns, size_t n, int epoch, char *out, size_t stride);
+
+/*!
+ * \brief Most characters one compiled format writes.
+ * \details Nine for the longest name, September or Wednesday, times the most
+ * operations.
+ */
+#define LEAP_FORMAT_MAX (LEAP_FORMAT_OPS * 9)
+
+/*!
+ * \brief Compiled format with a per-day cache.
+ * \details Splits the format at its first time-of-day conversion. Operations
+ * before the split depend on the day alone; the cache renders them once per
+ * day and copies the result until the day changes. A stream of timestamps in
+ * time order therefore decodes and renders its date once a day and only its
+ * time of day for every timestamp.
+ *
+ * Initialise with leap_format_cache_init(). One cache serves one stream at a
+ * time; it is not safe to share across threads.
+ */
+struct leap_format_cache {
+  /*!
+   * \brief Compiled format.
+   */
+  struct leap_format format;
+  /*!
+   * \brief Operations before this one depend on the day alone.
+   */
+  int split;
+  /*!
+   * \brief Characters in the rendered prefix, or -1 before the first day.
+   */
+  int len;
+  /*!
+   * \brief Absolute day of the rendered prefix.
+   */
+  int day;
+  /*!
+   * \brief Date of the day.
+   */
+  struct leap_date date;
+  /*!
+   * \brief Day of the year, 1 through 366.
+   */
+  int yday;
+  /*!
+   * \brief Day of the week, 0 for Sunday through 6 for Saturday.
+   */
+  int wday;
+  /*!
+   * \brief Prefix rendered for the day.
+   */
+  char prefix[LEAP_FORMAT_MAX];
+};
+
+/*!
+ * \brief Formats a date with a compiled format.
+ * \details Writes the characters and a terminating null as \c strftime does.
+ * Time-of-day conversions write midnight.
+ * \param format Compiled format.
+ * \param abs_day Absolute day within years 0000 through 9999.
+ * \param out Buffer for the characters.
+ * \param size Size of the buffer, including room for the null.
+ * \returns Number of characters written, not counting the null, or 0 if
+ * they and the null do not fit or the day lies beyond year 0000 or 9999.
+ */
+size_t leap_format_compiled(const struct leap_format *format, int abs_day, char *out, size_t size);
+
+/*!
+ * \brief Initialises a per-day format cache.
+ * \details Copies the compiled format and finds its split. Caches no day yet.
+ * \param cache Cache to initialise.
+ * \param format Compiled format.
+ */
+void leap_format_cache_init(struct leap_format_cache *cache, const struct leap_format *format);
+
+/*!
+ * \brief Formats a timestamp through a per-day cache.
+ * \details Renders the day's prefix only when the day differs from the last
+ * one formatted, then renders the rest of the format for the time of day.
+ * Writes the characters and a terminating null as leap_format_compiled()
+ * does.
+ * \param cache Per-day format cache.
+ * \param sec Seconds since the epoch, within years 0000 through 9999.
+ * \param epoch Absolute day of the epoch, for example LEAP_MCMLXX.
+ * \param out Buffer for the characters.
+ * \param size Size of the buffer, including room for the null.
+ * \returns Number of characters written, not counting the null, or 0 if
+ * they and the null do not fit or the time lies beyond year 0000 or 9999.
+ */
+size_t leap_format_cached(struct leap_format_cache *cache, int64_t sec, int epoch, char *out, size_t size);
+
+#endif /* __LEAP_FORMAT_H__ */
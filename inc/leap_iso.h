@@ -0,0 +1,118 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_iso.h
+ * \brief ISO 8601 week-date function prototypes.
+ * \details Converts between absolute days and ISO 8601 week dates. ISO weeks
+ * run Monday through Sunday. Week 1 of an ISO year is the week holding the
+ * year's first Thursday, equivalently the week holding the fourth of January,
+ * so the ISO year can start up to three days before or after the calendar
+ * year and can have 52 or 53 weeks.
+ *
+ * Every conversion runs in closed form: no loops around year boundaries.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#ifndef __LEAP_ISO_H__
+#define __LEAP_ISO_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*!
+ * \brief ISO 8601 week date.
+ */
+struct leap_iso {
+  /*!
+   * \brief ISO week-numbering year.
+   */
+  int year;
+  /*!
+   * \brief Week of the ISO year, 1 through 52 or 53.
+   */
+  int week;
+  /*!
+   * \brief Day of the ISO week, 1 for Monday through 7 for Sunday.
+   */
+  int wday;
+};
+
+/*!
+ * \brief Compares two leap_iso structures for equality.
+ * \param lhs The first leap_iso structure.
+ * \param rhs The second leap_iso structure.
+ * \retval true if both structures represent the same week date.
+ * \retval false otherwise.
+ */
+static inline bool equal_leap_iso(struct leap_iso lhs, struct leap_iso rhs) {
+  return lhs.year == rhs.year && lhs.week == rhs.week && lhs.wday == rhs.wday;
+}
+
+/*!
+ * \brief ISO week date from absolute day.
+ * \details Finds the Thursday of the day's week. The Thursday's calendar year
+ * is the ISO year, and its zero-based day of that year divided by seven
+ * counts the whole weeks before it.
+ * \param abs_day Absolute day.
+ * \returns ISO year, week and day of the week.
+ */
+struct leap_iso leap_iso_week(int abs_day);
+
+/*!
+ * \brief Absolute day from ISO week date.
+ * \details Steps back from the fourth of January, always in week 1, to the
+ * Monday starting week 1, then forward by whole weeks and days. Weeks and
+ * weekdays out of range carry into neighbouring weeks and years.
+ * \param year ISO year.
+ * \param week Week of the ISO year, 1 through 53.
+ * \param wday Day of the ISO week, 1 for Monday through 7 for Sunday.
+ * \returns Absolute day.
+ */
+int leap_iso_from(int year, int week, int wday);
+
+/*!
+ * \brief Absolute day from ISO week date structure.
+ * \param iso ISO week date.
+ * \returns Absolute day.
+ */
+static inline int leap_iso_from_iso(struct leap_iso iso) { return leap_iso_from(iso.year, iso.week, iso.wday); }
+
+/*!
+ * \brief ISO week-date columns.
+ * \details Points to one array per field. Null pointers skip their fields on
+ * output.
+ */
+struct leap_iso_cols {
+  /*!
+   * \brief ISO years.
+   */
+  int *year;
+  /*!
+   * \brief Weeks of the ISO year.
+   */
+  int *week;
+  /*!
+   * \brief Days of the ISO week.
+   */
+  int *wday;
+};
+
+/*!
+ * \brief Batch ISO week dates from absolute days.
+ * \details Element for element with leap_iso_week().
+ * \param abs_day Absolute days, \c n of them.
+ * \param n Number of days.
+ * \param cols Field columns, each with room for \c n fields or null.
+ */
+void leap_iso_week_n(const int *abs_day, size_t n, const struct leap_iso_cols *cols);
+
+/*!
+ * \brief Batch absolute days from ISO week dates.
+ * \details Element for element with leap_iso_from(). Reads every column; none
+ * may be null.
+ * \param cols ISO years, weeks and days of the week, \c n of each.
+ * \param n Number of week dates.
+ * \param abs_day Absolute days, with room for \c n of them.
+ */
+void leap_iso_from_n(const struct leap_iso_cols *cols, size_t n, int *abs_day);
+
+#endif /* __LEAP_ISO_H__ */
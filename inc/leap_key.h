@@ -0,0 +1,78 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_key.h
+ * \brief Integer date key prototypes.
+ * \details Converts between absolute days and integer date keys, dates
+ * written as the decimal number YYYYMMDD: 20240229 for the 29th of February
+ * 2024. Keys order as their dates do, which makes them popular join keys.
+ *
+ * Splitting a key into year, month and day divides by ten thousand and by one
+ * hundred. Both divisions multiply by fixed-point reciprocals instead.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#ifndef __LEAP_KEY_H__
+#define __LEAP_KEY_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*!
+ * \brief Smallest date key, 0000-01-01.
+ */
+#define LEAP_YMD_KEY_MIN 101
+
+/*!
+ * \brief Largest date key, 214748-12-31.
+ * \details The last date whose key fits a signed 32-bit integer.
+ */
+#define LEAP_YMD_KEY_MAX 2147481231
+
+/*!
+ * \brief Absolute day of the largest date key.
+ */
+#define LEAP_YMD_KEY_ABS_MAX 78435461
+
+/*!
+ * \brief Absolute day from date key.
+ * \details Validates the month and the day against the days in its month.
+ * \param key Date key, YYYYMMDD.
+ * \param abs_day Absolute day on success.
+ * \retval true if the key makes a valid date.
+ * \retval false otherwise, leaving \c abs_day alone.
+ */
+bool leap_ymd_key_to_abs(int32_t key, int *abs_day);
+
+/*!
+ * \brief Date key from absolute day.
+ * \param abs_day Absolute day.
+ * \returns Date key, or -1 for days before LEAP_YMD_KEY_MIN or after
+ * LEAP_YMD_KEY_MAX.
+ */
+int32_t leap_abs_to_ymd_key(int abs_day);
+
+/*!
+ * \brief Batch converts date keys to absolute days.
+ * \details Marks invalid keys in a bitmap as leap_parse_iso_date_n() does,
+ * answering absolute day 0 for them. Converts 64 keys at a time without
+ * branching, then gathers their invalid bits into one word.
+ * \param key Date keys, \c n of them.
+ * \param n Number of keys.
+ * \param abs_day Absolute days, with room for \c n of them.
+ * \param invalid Bitmap of invalid keys, with room for <tt>(n + 63) / 64</tt>
+ * words.
+ * \returns Number of invalid keys.
+ */
+size_t leap_ymd_key_to_abs_n(const int32_t *key, size_t n, int *abs_day, uint64_t *invalid);
+
+/*!
+ * \brief Batch converts absolute days to date keys.
+ * \details Answers -1 for days out of range as leap_abs_to_ymd_key() does.
+ * \param abs_day Absolute days, \c n of them.
+ * \param n Number of days.
+ * \param key Date keys, with room for \c n of them.
+ */
+void leap_abs_to_ymd_key_n(const int *abs_day, size_t n, int32_t *key);
+
+#endif /* __LEAP_KEY_H__ */
@@ -0,0 +1,179 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_month.h
+ * \brief Calendar month arithmetic prototypes.
+ * \details Adds whole months or years to dates. Adding months to a day near
+ * the end of a month can land beyond the end of a shorter month: 31 January
+ * plus one month has no 31 February. An end-of-month policy decides where such
+ * dates land.
+ *
+ * Differences between dates count whole months under the same policies, so
+ * that adding the difference back to the earlier date lands on the later one.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#ifndef __LEAP_MONTH_H__
+#define __LEAP_MONTH_H__
+
+#include "leap.h"
+
+#include <stddef.h>
+
+/*!
+ * \brief End-of-month policy.
+ */
+enum leap_eom {
+  /*!
+   * \brief Clamps to the last day of a shorter month.
+   * \details 31 January plus one month lands on 28 or 29 February.
+   */
+  LEAP_EOM_CLAMP,
+  /*!
+   * \brief Overflows into the following month.
+   * \details 31 January plus one month lands on 2 or 3 March, as
+   * leap_abs_from() normalises 31 February.
+   */
+  LEAP_EOM_OVERFLOW,
+  /*!
+   * \brief Sticks to the end of the month.
+   * \details The last day of a month lands on the last day of the target month,
+   * so that 28 February 2023 plus one month lands on 31 March. Other days clamp.
+   */
+  LEAP_EOM_STICK,
+};
+
+/*!
+ * \brief Adds months to a date.
+ * \details Carries months beyond December or before January into years by
+ * floored division. Never converts to and from absolute days.
+ * \param date Valid date.
+ * \param months Months to add, negative to subtract.
+ * \param eom End-of-month policy.
+ * \returns Valid date.
+ */
+struct leap_date leap_add_months(struct leap_date date, int months, enum leap_eom eom);
+
+/*!
+ * \brief Adds years to a date.
+ * \details Only 29 February needs the policy: it clamps or sticks to 28
+ * February, or overflows to 1 March, in common years.
+ * \param date Valid date.
+ * \param years Years to add, negative to subtract.
+ * \param eom End-of-month policy.
+ * \returns Valid date.
+ */
+struct leap_date leap_add_years(struct leap_date date, int years, enum leap_eom eom);
+
+/*!
+ * \brief Batch adds months to absolute days.
+ * \details Element for element, decodes each absolute day, adds the months
+ * with leap_add_months() and encodes the result, all in closed form.
+ * \param abs_day Absolute days, \c n of them.
+ * \param n Number of days.
+ * \param months Months to add to every day.
+ * \param eom End-of-month policy.
+ * \param result Absolute days, with room for \c n of them. May alias
+ * \c abs_day.
+ */
+void leap_add_months_n(const int *abs_day, size_t n, int months, enum leap_eom eom, int *result);
+
+/*!
+ * \brief Calendar difference.
+ * \details Years, months and days between two dates. Every field has the same
+ * sign, the sign of the difference.
+ */
+struct leap_diff {
+  /*!
+   * \brief Whole years.
+   */
+  int years;
+  /*!
+   * \brief Whole months beyond the years, 0 through 11 in magnitude.
+   */
+  int months;
+  /*!
+   * \brief Days beyond the months.
+   */
+  int days;
+};
+
+/*!
+ * \brief Compares two leap_diff structures for equality.
+ * \param lhs The first leap_diff structure.
+ * \param rhs The second leap_diff structure.
+ * \retval true if both structures represent the same difference.
+ * \retval false otherwise.
+ */
+static inline bool equal_leap_diff(struct leap_diff lhs, struct leap_diff rhs) {
+  return lhs.years == rhs.years && lhs.months == rhs.months && lhs.days == rhs.days;
+}
+
+/*!
+ * \brief Whole months between two dates.
+ * \details Answers the most months that leap_add_months() can add to the
+ * earlier date, under the given policy, without passing the later date.
+ * Answers the negated count when \c to precedes \c from. Someone born on 29
+ * February 2024 turns one on 28 February 2025 when clamping or sticking, but
+ * not until 1 March when overflowing.
+ * \param from Valid date.
+ * \param to Valid date.
+ * \param eom End-of-month policy.
+ * \returns Whole months, negative when \c to precedes \c from.
+ */
+int leap_months_between(struct leap_date from, struct leap_date to, enum leap_eom eom);
+
+/*!
+ * \brief Calendar difference between two dates.
+ * \details Splits leap_months_between() into years and months, then counts the
+ * days from the earlier date plus those months to the later date. Answers the
+ * negated difference from \c to to \c from when \c to precedes \c from.
+ * \param from Valid date.
+ * \param to Valid date.
+ * \param eom End-of-month policy.
+ * \returns Years, months and days.
+ */
+struct leap_diff leap_diff(struct leap_date from, struct leap_date to, enum leap_eom eom);
+
+/*!
+ * \brief Calendar difference columns.
+ * \details Points to one output array per field. Null pointers skip their
+ * fields.
+ */
+struct leap_diff_cols {
+  /*!
+   * \brief Whole years.
+   */
+  int *years;
+  /*!
+   * \brief Whole months beyond the years.
+   */
+  int *months;
+  /*!
+   * \brief Days beyond the months.
+   */
+  int *days;
+};
+
+/*!
+ * \brief Batch whole months between absolute days.
+ * \details Element for element with leap_months_between().
+ * \param from Absolute days, \c n of them.
+ * \param to Absolute days, \c n of them.
+ * \param n Number of pairs.
+ * \param eom End-of-month policy.
+ * \param months Whole months, with room for \c n of them.
+ */
+void leap_months_between_n(const int *from, const int *to, size_t n, enum leap_eom eom, int *months);
+
+/*!
+ * \brief Batch calendar differences between absolute days.
+ * \details Element for element with leap_diff().
+ * \param from Absolute days, \c n of them.
+ * \param to Absolute days, \c n of them.
+ * \param n Number of pairs.
+ * \param eom End-of-month policy.
+ * \param cols Field columns, each with room for \c n fields or null.
+ */
+void leap_diff_n(const int *from, const int *to, size_t n, enum leap_eom eom, const struct leap_diff_cols *cols);
+
+#endif /* __LEAP_MONTH_H__ */
@@ -0,0 +1,106 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_pack.h
+ * \brief Packed date prototypes.
+ * \details Packs a date into one 32-bit unsigned integer: the biased year in
+ * the top 23 bits, the month in the next four and the day of the month in the
+ * bottom five. Fields run from most to least significant, so that packed dates
+ * compare, sort and hash as plain unsigned integers in date order. A packed
+ * date takes a third of the space of struct leap_date.
+ *
+ * Packing and unpacking dates only shift and mask; the header inlines them.
+ * Packing and unpacking absolute days decode and encode the date as well.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#ifndef __LEAP_PACK_H__
+#define __LEAP_PACK_H__
+
+#include "leap.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*!
+ * \brief Bias added to packed years.
+ * \details Moves negative years above zero so that unsigned order matches
+ * year order.
+ */
+#define LEAP_PACK_YEAR_BIAS 4194304
+
+/*!
+ * \brief Earliest year that packs.
+ */
+#define LEAP_PACK_YEAR_MIN (-LEAP_PACK_YEAR_BIAS)
+
+/*!
+ * \brief Latest year that packs.
+ */
+#define LEAP_PACK_YEAR_MAX (LEAP_PACK_YEAR_BIAS - 1)
+
+/*!
+ * \brief Earliest absolute day that packs, the first day of
+ * LEAP_PACK_YEAR_MIN.
+ */
+#define LEAP_PACK_ABS_MIN (-1531938078)
+
+/*!
+ * \brief Latest absolute day that packs, the last day of LEAP_PACK_YEAR_MAX.
+ */
+#define LEAP_PACK_ABS_MAX 1531938077
+
+/*!
+ * \brief Packs a date.
+ * \param date Valid date with a year from LEAP_PACK_YEAR_MIN through
+ * LEAP_PACK_YEAR_MAX.
+ * \returns Packed date.
+ */
+static inline uint32_t leap_pack(struct leap_date date) {
+  return (uint32_t)(date.year + LEAP_PACK_YEAR_BIAS) << 9 | (uint32_t)date.month << 5 | (uint32_t)date.day;
+}
+
+/*!
+ * \brief Unpacks a date.
+ * \param packed Packed date.
+ * \returns Date.
+ */
+static inline struct leap_date leap_unpack(uint32_t packed) {
+  return (struct leap_date){
+      .year = (int)(packed >> 9) - LEAP_PACK_YEAR_BIAS,
+      .month = (int)(packed >> 5 & 15),
+      .day = (int)(packed & 31),
+  };
+}
+
+/*!
+ * \brief Packs an absolute day.
+ * \param abs_day Absolute day from LEAP_PACK_ABS_MIN through
+ * LEAP_PACK_ABS_MAX.
+ * \returns Packed date.
+ */
+uint32_t leap_abs_pack(int abs_day);
+
+/*!
+ * \brief Absolute day of a packed date.
+ * \param packed Packed date.
+ * \returns Absolute day.
+ */
+int leap_pack_abs(uint32_t packed);
+
+/*!
+ * \brief Batch packs absolute days.
+ * \param abs_day Absolute days, \c n of them.
+ * \param n Number of days.
+ * \param packed Packed dates, with room for \c n of them.
+ */
+void leap_abs_pack_n(const int *abs_day, size_t n, uint32_t *packed);
+
+/*!
+ * \brief Batch unpacks packed dates to absolute days.
+ * \param packed Packed dates, \c n of them.
+ * \param n Number of dates.
+ * \param abs_day Absolute days, with room for \c n of them.
+ */
+void leap_pack_abs_n(const uint32_t *packed, size_t n, int *abs_day);
+
+#endif /* __LEAP_PACK_H__ */
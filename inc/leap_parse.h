@@ -0,0 +1,124 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_parse.h
+ * \brief Date parsing prototypes.
+ * \details Parses fixed-width ISO 8601 dates straight to absolute days without
+ * the C library. Parsers validate as they go: every digit must be a decimal
+ * digit, every separator a hyphen, every month 1 through 12 and every day
+ * within its month or year.
+ *
+ * Batch parsers handle every row the same way, valid or not, and report the
+ * invalid rows through a bitmap rather than branching on them.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#ifndef __LEAP_PARSE_H__
+#define __LEAP_PARSE_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*!
+ * \brief ISO 8601 date form.
+ * \details Every form carries a four-digit year, 0000 through 9999.
+ */
+enum leap_iso_date {
+  /*!
+   * \brief Extended calendar date, YYYY-MM-DD, ten characters.
+   */
+  LEAP_ISO_DATE_EXTENDED,
+  /*!
+   * \brief Basic calendar date, YYYYMMDD, eight characters.
+   */
+  LEAP_ISO_DATE_BASIC,
+  /*!
+   * \brief Extended ordinal date, YYYY-DDD, eight characters.
+   * \details Days of the year run from 001 through 365 or 366.
+   */
+  LEAP_ISO_DATE_ORDINAL,
+};
+
+/*!
+ * \brief Width of an ISO 8601 date form.
+ * \param form Date form.
+ * \returns Characters in the form: 10 for extended calendar dates, otherwise 8.
+ */
+static inline size_t leap_iso_date_width(enum leap_iso_date form) { return form == LEAP_ISO_DATE_EXTENDED ? 10 : 8; }
+
+/*!
+ * \brief Parses an ISO 8601 date.
+ * \details Reads exactly the form's width of characters; needs no terminator.
+ * \param text Characters to parse.
+ * \param form Date form.
+ * \param abs_day Absolute day on success.
+ * \retval true if the characters hold a valid date in the given form.
+ * \retval false otherwise, leaving \c abs_day alone.
+ */
+bool leap_parse_iso_date(const char *text, enum leap_iso_date form, int *abs_day);
+
+/*!
+ * \brief Batch parses ISO 8601 dates.
+ * \details Parses \c n fixed-width fields, the first at \c text and each
+ * following \c stride characters after the one before. Sets bit \c i%64 of
+ * word \c i/64 in \c invalid for every invalid field \c i and clears the bits of
+ * valid fields.
+ * \param text First field.
+ * \param stride Characters from one field to the next, at least the form's
+ * width.
+ * \param n Number of fields.
+ * \param form Date form of every field.
+ * \param abs_day Absolute days, with room for \c n of them. Invalid fields
+ * answer absolute day 0.
+ * \param invalid Bitmap of invalid fields, with room for <tt>(n + 63) / 64</tt>
+ * words.
+ * \returns Number of invalid fields.
+ */
+size_t leap_parse_iso_date_n(const char *text, size_t stride, size_t n, enum leap_iso_date form, int *abs_day,
+                             uint64_t *invalid);
+
+/*!
+ * \brief Parses an RFC 3339 timestamp.
+ * \details Parses exactly \c len characters of the form
+ * <tt>YYYY-MM-DDTHH:MM:SS[.F...](Z|+HH:MM|-HH:MM)</tt>, such as
+ * <tt>2024-02-29T23:59:59.123456789+05:30</tt>. Accepts a lower-case \c t or
+ * a space in place of \c T and a lower-case \c z. Keeps the first nine
+ * fractional digits and ignores any more. A leap second, second 60, carries
+ * into the following minute. Subtracts the offset to answer Coordinated
+ * Universal Time.
+ *
+ * Neither allocates nor calls the C library's time functions.
+ * \param text Characters to parse.
+ * \param len Number of characters.
+ * \param epoch Absolute day of the epoch, for example LEAP_MCMLXX.
+ * \param ns Nanoseconds since the epoch on success.
+ * \retval true if the characters hold a valid timestamp whose nanoseconds
+ * fit 64 bits.
+ * \retval false otherwise, leaving \c ns alone.
+ */
+bool leap_parse_rfc3339(const char *text, size_t len, int epoch, int64_t *ns);
+
+/*!
+ * \brief Streams RFC 3339 timestamps.
+ * \details Parses delimited records, such as lines, from a buffer with
+ * leap_parse_rfc3339(). Drops a carriage return before each delimiter. Stops
+ * after \c n records or at the last delimiter, whichever comes first, leaving
+ * any unterminated tail for the next call: at the end of the stream, append a
+ * delimiter or parse the tail alone. Marks invalid records in a bitmap as
+ * leap_parse_iso_date_n() does, answering zero nanoseconds for them.
+ * \param text Buffer.
+ * \param len Characters in the buffer.
+ * \param delim Record delimiter, for example a newline or comma.
+ * \param epoch Absolute day of the epoch.
+ * \param ns Nanoseconds since the epoch, with room for \c n of them.
+ * \param invalid Bitmap of invalid records, with room for <tt>(n + 63) /
+ * 64</tt> words.
+ * \param n Most records to parse.
+ * \param used Characters consumed on return, through the last delimiter
+ * parsed. Pass the buffer from there onwards to the next call.
+ * \returns Number of records parsed.
+ */
+size_t leap_parse_rfc3339_n(const char *text, size_t len, char delim, int epoch, int64_t *ns, uint64_t *invalid,
+                            size_t n, size_t *used);
+
+#endif /* __LEAP_PARSE_H__ */
@@ -0,0 +1,143 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_stats.h
+ * \brief Leap statistics counter prototypes.
+ * \details Optional per-thread counters for hot-path introspection. Counts
+ * calls per function, the number of times leap_off() loops while normalising
+ * and the number of month steps leap_date() takes.
+ *
+ * Counting only happens when the library compiles with \c LEAPC_STATS defined.
+ * Without it, the counting macro expands to nothing and the snapshot answers
+ * all zeros.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#ifndef __LEAP_STATS_H__
+#define __LEAP_STATS_H__
+
+/*!
+ * \brief Leap statistics counters.
+ * \details One counter per library function plus the loop counters. Members
+ * carry the name of the function they count so that the counting macro can
+ * take the function name as its argument.
+ */
+struct leap_stats {
+  /*!
+   * \brief Calls to is_leap().
+   */
+  unsigned long is_leap;
+  /*!
+   * \brief Calls to leap_add().
+   */
+  unsigned long leap_add;
+  /*!
+   * \brief Calls to leap_thru().
+   */
+  unsigned long leap_thru;
+  /*!
+   * \brief Calls to leap_day().
+   */
+  unsigned long leap_day;
+  /*!
+   * \brief Calls to leap_off().
+   */
+  unsigned long leap_off;
+  /*!
+   * \brief Normalisation loop iterations within leap_off().
+   * \details Zero iterations means that the day offset already sat within the
+   * year. Compare with the \c leap_off count to see how often normalisation
+   * actually loops.
+   */
+  unsigned long leap_off_loop;
+  /*!
+   * \brief Calls to leap_mday().
+   */
+  unsigned long leap_mday;
+  /*!
+   * \brief Calls to leap_yday().
+   */
+  unsigned long leap_yday;
+  /*!
+   * \brief Calls to leap_date().
+   */
+  unsigned long leap_date;
+  /*!
+   * \brief Month steps within leap_date().
+   * \details Counts the months subtracted from the day of year on the way to
+   * the target month: none for January, eleven for December.
+   */
+  unsigned long leap_date_step;
+  /*!
+   * \brief Calls to leap_from().
+   */
+  unsigned long leap_from;
+  /*!
+   * \brief Calls to leap_abs_date().
+   */
+  unsigned long leap_abs_date;
+  /*!
+   * \brief Calls to leap_abs_from().
+   */
+  unsigned long leap_abs_from;
+  /*!
+   * \brief Calls to leap_abs_year().
+   */
+  unsigned long leap_abs_year;
+  /*!
+   * \brief Calls to leap_abs_year_month().
+   */
+  unsigned long leap_abs_year_month;
+  /*!
+   * \brief Calls to quo_mod().
+   */
+  unsigned long quo_mod;
+};
+
+/*!
+ * \brief Snapshot of the calling thread's statistics.
+ * \details Copies the counters belonging to the calling thread. Other threads
+ * count independently.
+ * \returns The current counters, or all zeros when the library compiles
+ * without \c LEAPC_STATS.
+ */
+struct leap_stats leap_stats_snapshot(void);
+
+/*!
+ * \brief Resets the calling thread's statistics.
+ * \details Zeros every counter belonging to the calling thread.
+ */
+void leap_stats_reset(void);
+
+#ifdef LEAPC_STATS
+
+/*
+ * Thread-local storage keeps the counters free of atomics and of contention.
+ * MSVC spells its storage class differently.
+ */
+#ifdef _MSC_VER
+#define LEAP_STATS_THREAD __declspec(thread)
+#else
+#define LEAP_STATS_THREAD _Thread_local
+#endif
+
+/*!
+ * \brief Per-thread statistics counters.
+ * \details Library internals increment these through the LEAP_STATS_INC()
+ * macro. Applications should take a leap_stats_snapshot() instead of reading
+ * them directly.
+ */
+extern LEAP_STATS_THREAD struct leap_stats leap_stats_tls;
+
+/*!
+ * \brief Increments a statistics counter.
+ * \param member Name of the \c leap_stats counter to increment.
+ */
+#define LEAP_STATS_INC(member) (++leap_stats_tls.member)
+
+#else
+
+#define LEAP_STATS_INC(member) ((void)0)
+
+#endif /* LEAPC_STATS */
+
+#endif /* __LEAP_STATS_H__ */
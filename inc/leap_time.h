@@ -0,0 +1,190 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_time.h
+ * \brief Leap time function prototypes.
+ * \details Converts 64-bit timestamps in seconds, milliseconds, microseconds or
+ * nanoseconds into dates with time of day, and back again. Timestamps count
+ * from the first day of some epoch given as an absolute day, for example
+ * LEAP_MCMLXX for Unix time.
+ *
+ * Conversions split timestamps into days and time of day by multiplying by
+ * fixed-point reciprocals rather than dividing, then decode the day in closed
+ * form. They use neither the C library's time functions nor its locale.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#ifndef __LEAP_TIME_H__
+#define __LEAP_TIME_H__
+
+#include "leap.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*!
+ * \brief Leap date and time of day.
+ * \details Represents a timestamp as a date plus hours, minutes, seconds and a
+ * fraction of a second.
+ */
+struct leap_time {
+  /*!
+   * \brief Year, month and day of month.
+   */
+  struct leap_date date;
+  /*!
+   * \brief Hour of the day, 0 through 23.
+   */
+  int hour;
+  /*!
+   * \brief Minute of the hour, 0 through 59.
+   */
+  int min;
+  /*!
+   * \brief Second of the minute, 0 through 59.
+   */
+  int sec;
+  /*!
+   * \brief Fraction of the second.
+   * \details Counts in the units of the conversion: milliseconds for
+   * leap_time_ms(), microseconds for leap_time_us(), nanoseconds for
+   * leap_time_ns(); always zero for leap_time().
+   */
+  int subsec;
+};
+
+/*!
+ * \brief Compares two leap_time structures for equality.
+ * \param lhs The first leap_time structure.
+ * \param rhs The second leap_time structure.
+ * \retval true if both structures represent the same date and time.
+ * \retval false otherwise.
+ */
+static inline bool equal_leap_time(struct leap_time lhs, struct leap_time rhs) {
+  return equal_leap_date(lhs.date, rhs.date) && lhs.hour == rhs.hour && lhs.min == rhs.min && lhs.sec == rhs.sec &&
+         lhs.subsec == rhs.subsec;
+}
+
+/*!
+ * \brief Date and time from seconds.
+ * \details Floors the seconds into days so that negative timestamps fall on
+ * the days before the epoch.
+ * \param sec Seconds since the epoch.
+ * \param epoch Absolute day of the epoch, for example LEAP_MCMLXX.
+ * \returns Date and time of day. The epoch plus the timestamp's days must lie
+ * within the safe integer range.
+ */
+struct leap_time leap_time(int64_t sec, int epoch);
+
+/*!
+ * \brief Date and time from milliseconds.
+ * \param ms Milliseconds since the epoch.
+ * \param epoch Absolute day of the epoch.
+ * \returns Date and time of day with milliseconds.
+ */
+struct leap_time leap_time_ms(int64_t ms, int epoch);
+
+/*!
+ * \brief Date and time from microseconds.
+ * \param us Microseconds since the epoch.
+ * \param epoch Absolute day of the epoch.
+ * \returns Date and time of day with microseconds.
+ */
+struct leap_time leap_time_us(int64_t us, int epoch);
+
+/*!
+ * \brief Date and time from nanoseconds.
+ * \details Every 64-bit nanosecond count converts, from 1677 through 2262 when
+ * counting from Unix time.
+ * \param ns Nanoseconds since the epoch.
+ * \param epoch Absolute day of the epoch.
+ * \returns Date and time of day with nanoseconds.
+ */
+struct leap_time leap_time_ns(int64_t ns, int epoch);
+
+/*!
+ * \brief Seconds from date and time.
+ * \details Normalises as leap_abs_from() does: months and days out of range
+ * carry into years and months. Hours, minutes and seconds out of range carry
+ * likewise. Ignores the fraction of a second.
+ * \param time Date and time of day.
+ * \param epoch Absolute day of the epoch.
+ * \returns Seconds since the epoch.
+ */
+int64_t leap_time_from(struct leap_time time, int epoch);
+
+/*!
+ * \brief Milliseconds from date and time.
+ * \param time Date and time of day with milliseconds.
+ * \param epoch Absolute day of the epoch.
+ * \returns Milliseconds since the epoch.
+ */
+int64_t leap_time_from_ms(struct leap_time time, int epoch);
+
+/*!
+ * \brief Microseconds from date and time.
+ * \param time Date and time of day with microseconds.
+ * \param epoch Absolute day of the epoch.
+ * \returns Microseconds since the epoch.
+ */
+int64_t leap_time_from_us(struct leap_time time, int epoch);
+
+/*!
+ * \brief Nanoseconds from date and time.
+ * \param time Date and time of day with nanoseconds.
+ * \param epoch Absolute day of the epoch.
+ * \returns Nanoseconds since the epoch.
+ */
+int64_t leap_time_from_ns(struct leap_time time, int epoch);
+
+/*!
+ * \brief Leap time field columns.
+ * \details Points to one output array per field. Null pointers skip their
+ * fields: batch conversions neither compute nor store them. Skipping every
+ * date field skips date decoding altogether; skipping every time field skips
+ * splitting the time of day.
+ */
+struct leap_time_cols {
+  /*!
+   * \brief Years.
+   */
+  int *year;
+  /*!
+   * \brief Months, 1 through 12.
+   */
+  int *month;
+  /*!
+   * \brief Days of the month, 1 through 31.
+   */
+  int *day;
+  /*!
+   * \brief Hours of the day, 0 through 23.
+   */
+  int *hour;
+  /*!
+   * \brief Minutes of the hour, 0 through 59.
+   */
+  int *min;
+  /*!
+   * \brief Seconds of the minute, 0 through 59.
+   */
+  int *sec;
+  /*!
+   * \brief Nanoseconds of the second, 0 through 999,999,999.
+   */
+  int *nsec;
+};
+
+/*!
+ * \brief Batch date and time fields from nanoseconds.
+ * \details Decodes a column of 64-bit nanosecond timestamps into field
+ * columns, element for element with leap_time_ns(). Works through the column
+ * in blocks: one branch-free pass splits a block into days and nanoseconds of
+ * the day, then further passes decode only the fields wanted.
+ * \param ns Nanoseconds since the epoch, \c n of them.
+ * \param n Number of timestamps.
+ * \param epoch Absolute day of the epoch.
+ * \param cols Field columns, each with room for \c n fields or null.
+ */
+void leap_time_ns_n(const int64_t *ns, size_t n, int epoch, const struct leap_time_cols *cols);
+
+#endif /* __LEAP_TIME_H__ */
@@ -0,0 +1,44 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_tm.h
+ * \brief Standard broken-down time prototypes.
+ * \details Drop-in replacements for the C library's \c gmtime_r and \c timegm
+ * functions built on leapc's arithmetic. They take no locks and consult no
+ * time zone.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#ifndef __LEAP_TM_H__
+#define __LEAP_TM_H__
+
+#include <time.h>
+
+/*!
+ * \brief Broken-down Coordinated Universal Time from calendar time.
+ * \details Fills every standard field of \c result, including the day of the
+ * week \c tm_wday and the day of the year \c tm_yday. Daylight saving never
+ * applies. Where the C library carries them, sets the offset from UTC to zero
+ * and the zone to "GMT".
+ * \param timep Seconds since 1970-01-01 00:00:00 UTC.
+ * \param result Broken-down time to fill.
+ * \returns \c result, or \c NULL with \c errno set to \c EOVERFLOW when the
+ * time falls outside the safe integer range of years, LEAP_YEAR_MIN through
+ * LEAP_YEAR_MAX.
+ */
+struct tm *leap_gmtime_r(const time_t *timep, struct tm *result);
+
+/*!
+ * \brief Calendar time from broken-down Coordinated Universal Time.
+ * \details Normalises like the C library. Seconds, minutes and hours out of
+ * range carry into days; months out of range carry into years; days of the
+ * month out of range carry into months. Ignores \c tm_wday, \c tm_yday and
+ * \c tm_isdst on input. Rewrites every field of \c tm with the normalised time
+ * on success.
+ * \param tm Broken-down time to convert and normalise.
+ * \returns Seconds since 1970-01-01 00:00:00 UTC, or <tt>(time_t)-1</tt> with
+ * \c errno set to \c EOVERFLOW when the normalised time falls outside the safe
+ * integer range of years or outside \c time_t.
+ */
+time_t leap_timegm(struct tm *tm);
+
+#endif /* __LEAP_TM_H__ */
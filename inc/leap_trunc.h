@@ -0,0 +1,95 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_trunc.h
+ * \brief Time-bucket truncation prototypes.
+ * \details Floors absolute days and timestamps to the first day of their week,
+ * month, quarter or year. Goes straight to the bucket's first day without
+ * building the full date and encoding it again.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#ifndef __LEAP_TRUNC_H__
+#define __LEAP_TRUNC_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*!
+ * \brief Calendar bucket unit.
+ */
+enum leap_unit {
+  /*!
+   * \brief Day; truncating by day leaves absolute days alone.
+   */
+  LEAP_UNIT_DAY,
+  /*!
+   * \brief ISO week, starting on Monday.
+   */
+  LEAP_UNIT_WEEK,
+  /*!
+   * \brief Calendar month.
+   */
+  LEAP_UNIT_MONTH,
+  /*!
+   * \brief Calendar quarter, starting in January, April, July or October.
+   */
+  LEAP_UNIT_QUARTER,
+  /*!
+   * \brief Calendar year.
+   */
+  LEAP_UNIT_YEAR,
+};
+
+/*!
+ * \brief Truncates an absolute day.
+ * \param abs_day Absolute day.
+ * \param unit Bucket unit.
+ * \returns Absolute day starting the bucket holding \c abs_day.
+ */
+int leap_trunc(int abs_day, enum leap_unit unit);
+
+/*!
+ * \brief Truncates seconds.
+ * \details Floors the seconds to days then truncates the day.
+ * \param sec Seconds since the epoch.
+ * \param epoch Absolute day of the epoch, for example LEAP_MCMLXX.
+ * \param unit Bucket unit.
+ * \returns Seconds since the epoch at midnight starting the bucket.
+ */
+int64_t leap_trunc_time(int64_t sec, int epoch, enum leap_unit unit);
+
+/*!
+ * \brief Truncates nanoseconds.
+ * \param ns Nanoseconds since the epoch.
+ * \param epoch Absolute day of the epoch.
+ * \param unit Bucket unit.
+ * \returns Nanoseconds since the epoch at midnight starting the bucket. Wraps
+ * if the bucket starts before the earliest 64-bit nanosecond time.
+ */
+int64_t leap_trunc_time_ns(int64_t ns, int epoch, enum leap_unit unit);
+
+/*!
+ * \brief Batch truncates absolute days.
+ * \details Element for element with leap_trunc(). Picks the unit once, outside
+ * a straight-line loop.
+ * \param abs_day Absolute days, \c n of them.
+ * \param n Number of days.
+ * \param unit Bucket unit.
+ * \param result Absolute days starting the buckets, with room for \c n of them.
+ * May alias \c abs_day.
+ */
+void leap_trunc_n(const int *abs_day, size_t n, enum leap_unit unit, int *result);
+
+/*!
+ * \brief Batch truncates nanoseconds.
+ * \details Element for element with leap_trunc_time_ns().
+ * \param ns Nanoseconds since the epoch, \c n of them.
+ * \param n Number of timestamps.
+ * \param epoch Absolute day of the epoch.
+ * \param unit Bucket unit.
+ * \param result Nanoseconds starting the buckets, with room for \c n of them.
+ * May alias \c ns.
+ */
+void leap_trunc_time_ns_n(const int64_t *ns, size_t n, int epoch, enum leap_unit unit, int64_t *result);
+
+#endif /* __LEAP_TRUNC_H__ */
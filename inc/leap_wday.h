@@ -0,0 +1,53 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_wday.h
+ * \brief Leap weekday function prototypes.
+ * \details Answers the day of the week for absolute days and for dates.
+ * Weekdays count from Sunday, day 0, through Saturday, day 6, as the standard
+ * \c tm_wday field does. Every function floors, so that days before absolute
+ * day 0 fall on the right weekdays, and none divides or branches.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#ifndef __LEAP_WDAY_H__
+#define __LEAP_WDAY_H__
+
+#include <stddef.h>
+
+/*!
+ * \brief Weekday of absolute day 0.
+ * \details The first of January in year 0 fell on a Saturday.
+ */
+#define LEAP_WDAY0 6
+
+/*!
+ * \brief Weekday from absolute day.
+ * \param abs_day Absolute day, negative or positive.
+ * \returns Day of the week, 0 for Sunday through 6 for Saturday.
+ */
+int leap_wday(int abs_day);
+
+/*!
+ * \brief Weekday from date.
+ * \details Skips decoding the date to an absolute day. Counts one weekday for
+ * every year, since 365 days leave one day over after whole weeks, plus one
+ * more for every leap year passed, plus a fixed offset for each month.
+ * Normalises as leap_abs_from() does: months out of range carry into years
+ * and days out of range carry into months.
+ * \param year Year.
+ * \param month Month of the year, 1 through 12.
+ * \param day Day of the month, 1 through 31.
+ * \returns Day of the week, 0 for Sunday through 6 for Saturday.
+ */
+int leap_wday_from(int year, int month, int day);
+
+/*!
+ * \brief Batch weekdays from absolute days.
+ * \details Runs one straight-line loop that compilers vectorise.
+ * \param abs_day Absolute days, \c n of them.
+ * \param n Number of days.
+ * \param wday Days of the week, with room for \c n of them.
+ */
+void leap_wday_n(const int *abs_day, size_t n, int *wday);
+
+#endif /* __LEAP_WDAY_H__ */
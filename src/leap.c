@@ -8,9 +8,13 @@
  */
 
 #include "leap.h"
+#include "leap_cal.h"
+#include "leap_div.h"
+#include "leap_stats.h"
 #include "quo_mod.h"
 
 bool is_leap(int year) {
+  LEAP_STATS_INC(is_leap);
   /*
    * Allow C99's standard precedence to rule over operator ordering: modulo
    * exceeds equality and inequality operators. No need for brackets except
@@ -22,19 +26,39 @@ bool is_leap(int year) {
    * using the \c & operator is possible but reduces readability. Instead, rely
    * on compiler optimisation.
    */
+#if defined(LEAPC_NO_DIVIDE)
+  /*
+   * Four and twenty-five factor one hundred; sixteen and twenty-five factor
+   * four hundred. Masks test for the powers of two. A multiplicative inverse
+   * tests for twenty-five. Branch free.
+   */
+  const int by25 = leap_div_by25(year);
+  return ((year & 3) == 0) & (!by25 | ((year & 15) == 0));
+#elif defined(LEAPC_WCET)
+  /*
+   * Bitwise rather than logical operators evaluate every term. No
+   * short-circuit exits early.
+   */
+  return (year % 4 == 0) & ((year % 100 != 0) | (year % 400 == 0));
+#else
   return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+#endif
 }
 
-int leap_add(int year) { return is_leap(year) ? 1 : 0; }
+int leap_add(int year) {
+  LEAP_STATS_INC(leap_add);
+  return is_leap(year) ? 1 : 0;
+}
 
 int leap_thru(int year) {
+  LEAP_STATS_INC(leap_thru);
   /*
    * Expand the quotient terms first for debugging. Make it easier to see the
    * terms of the thru-sum.
    */
-  const int q4 = quo_mod(year, 4).quo;
-  const int q100 = quo_mod(year, 100).quo;
-  const int q400 = quo_mod(year, 400).quo;
+  const int q4 = LEAP_QUO_MOD(year, 4).quo;
+  const int q100 = LEAP_QUO_MOD(year, 100).quo;
+  const int q400 = LEAP_QUO_MOD(year, 400).quo;
   return q4 - q100 + q400;
 }
 
@@ -45,7 +69,24 @@ int leap_thru(int year) {
  * `leap_day(0) == 0` and `leap_day(1) == 366`. Constant offsets cancel in
  * subtractions, preserving year differences.
  */
-int leap_day(int year) { return year * 365 + leap_thru(year - 1) + 1; }
+int leap_day(int year) {
+  LEAP_STATS_INC(leap_day);
+  return year * 365 + leap_thru(year - 1) + 1;
+}
+
+#if defined(LEAPC_WCET) || defined(LEAPC_NO_DIVIDE)
+
+/*
+ * Normalises in closed form. Converts to an absolute day then decodes the year
+ * and day of year without looping. Looping would divide by the length of the
+ * year, 365 or 366, not a constant.
+ */
+struct leap_off leap_off(int year, int day_off) {
+  LEAP_STATS_INC(leap_off);
+  return leap_cal_off(leap_day(year) + day_off);
+}
+
+#else
 
 /*
  * Normalises an arbitrary day offset relative to a given year into a canonical
@@ -68,8 +109,10 @@ int leap_day(int year) { return year * 365 + leap_thru(year - 1) + 1; }
  *    exact rebasing regardless of the `+1` anchor in `leap_day`.
  */
 struct leap_off leap_off(int year, int day_off) {
+  LEAP_STATS_INC(leap_off);
   int days = 365 + leap_add(year);
   while (day_off < 0 || day_off >= days) {
+    LEAP_STATS_INC(leap_off_loop);
     int year0 = year + quo_mod(day_off, days).quo;
     day_off += leap_day(year) - leap_day(year0);
     days = 365 + leap_add(year = year0);
@@ -77,18 +120,46 @@ struct leap_off leap_off(int year, int day_off) {
   return (struct leap_off){.year = year, .day = day_off};
 }
 
+#endif /* LEAPC_WCET || LEAPC_NO_DIVIDE */
+
 int leap_mday(int year, int month) {
+  LEAP_STATS_INC(leap_mday);
   static const int MDAY[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-  const struct quo_mod qm = quo_mod(month - 1, 12);
+  const struct quo_mod qm = LEAP_QUO_MOD(month - 1, 12);
+#ifdef LEAPC_WCET
+  /*
+   * Always add leap days, multiplying by zero unless February.
+   */
+  return MDAY[qm.mod] + (qm.mod == 1) * leap_add(year + qm.quo);
+#else
   return MDAY[qm.mod] + (qm.mod == 1 ? leap_add(year + qm.quo) : 0);
+#endif
 }
 
 int leap_yday(int year, int month) {
+  LEAP_STATS_INC(leap_yday);
   static const int YDAY[] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
-  const struct quo_mod qm = quo_mod(month - 1, 12);
+  const struct quo_mod qm = LEAP_QUO_MOD(month - 1, 12);
+#ifdef LEAPC_WCET
+  return YDAY[qm.mod] + (qm.mod > 1) * leap_add(year + qm.quo);
+#else
   return YDAY[qm.mod] + (qm.mod > 1 ? leap_add(year + qm.quo) : 0);
+#endif
 }
 
+#if defined(LEAPC_WCET) || defined(LEAPC_NO_DIVIDE)
+
+/*
+ * Decodes in closed form. Converts to an absolute day then decodes the year,
+ * month and day of month without stepping through months.
+ */
+struct leap_date leap_date(int year, int day_off) {
+  LEAP_STATS_INC(leap_date);
+  return leap_cal_date(leap_day(year) + day_off);
+}
+
+#else
+
 /*
  * Converts a (year, day-of-year) pair into a (year, month, day-of-month)
  * triple.
@@ -102,6 +173,7 @@ int leap_yday(int year, int month) {
  *    month (to convert from 0-based to 1-based).
  */
 struct leap_date leap_date(int year, int day_off) {
+  LEAP_STATS_INC(leap_date);
   struct leap_off off = leap_off(year, day_off);
   int month = 1;
   /*
@@ -118,6 +190,7 @@ struct leap_date leap_date(int year, int day_off) {
       break;
     }
     off.day -= mday;
+    LEAP_STATS_INC(leap_date_step);
   }
   return (struct leap_date){
       .year = off.year,
@@ -126,15 +199,41 @@ struct leap_date leap_date(int year, int day_off) {
   };
 }
 
+#endif /* LEAPC_WCET || LEAPC_NO_DIVIDE */
+
 struct leap_off leap_from(int year, int month, int day) {
-  const struct quo_mod qm = quo_mod(month - 1, 12);
+  LEAP_STATS_INC(leap_from);
+  const struct quo_mod qm = LEAP_QUO_MOD(month - 1, 12);
   year += qm.quo;
   return leap_off(year, leap_yday(year, qm.mod + 1) + day - 1);
 }
 
-struct leap_date leap_abs_date(int day_off) { return leap_date(0, day_off); }
+struct leap_date leap_abs_date(int day_off) {
+  LEAP_STATS_INC(leap_abs_date);
+  return leap_date(0, day_off);
+}
 
 int leap_abs_from(int year, int month, int day) {
+  LEAP_STATS_INC(leap_abs_from);
   const struct leap_off off = leap_from(year, month, day);
   return leap_day(off.year) + off.day;
 }
+
+/*
+ * Decodes the March-based year and day in closed form, whatever the build, then
+ * stops. Days 306 onwards, January and February, belong to the next calendar
+ * year.
+ */
+int leap_abs_year(int day_off) {
+  LEAP_STATS_INC(leap_abs_year);
+  const struct leap_cal cal = leap_cal(day_off);
+  return cal.year + (cal.day >= 306);
+}
+
+struct leap_year_month leap_abs_year_month(int day_off) {
+  LEAP_STATS_INC(leap_abs_year_month);
+  const struct leap_cal cal = leap_cal(day_off);
+  const int mp = LEAP_DIV_U31(5 * cal.day + 2, 153);
+  const int jan = mp >= 10;
+  return (struct leap_year_month){.year = cal.year + jan, .month = mp + 3 - 12 * jan};
+}
@@ -0,0 +1,436 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_arrow.c
+ * \brief Apache Arrow adapter implementations.
+ * \details Implements the Arrow C data interface adapters declared in the
+ * \c leap_arrow.h header file.
+ *
+ * Every exported array owns one 64-byte aligned allocation: the array's own
+ * bookkeeping, its children and their buffer pointers, then the buffers
+ * themselves, each starting on a 64-byte boundary as Arrow recommends. The
+ * parent and each child hold a reference to the block, because a consumer may
+ * move children out and release them after the parent; whichever release
+ * comes last frees it. Exported schemas work the same way.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#include "leap_arrow.h"
+#include "leap.h"
+#include "leap_cal.h"
+#include "leap_div.h"
+#include "leap_wday.h"
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * MSVC has neither aligned_alloc() nor, without an experimental switch, C11
+ * atomics. It has aligned allocation and interlocked decrements of its own.
+ */
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+typedef volatile long leap_arrow_refs;
+#else
+#include <stdatomic.h>
+typedef atomic_int leap_arrow_refs;
+#endif
+
+/*!
+ * \brief Slots per conversion block.
+ */
+#define LEAP_ARROW_BLOCK 256
+
+/*!
+ * \brief Exported calendar fields.
+ */
+#define LEAP_ARROW_FIELDS 4
+
+static const char *const LEAP_ARROW_NAME[LEAP_ARROW_FIELDS] = {"year", "month", "day", "weekday"};
+
+/*
+ * Units of the input types: days for date32, then divisors for the rest.
+ */
+enum leap_arrow_unit {
+  LEAP_ARROW_DAY,
+  LEAP_ARROW_SEC,
+  LEAP_ARROW_MS,
+  LEAP_ARROW_US,
+  LEAP_ARROW_NS,
+};
+
+/*
+ * Bookkeeping for an exported array and its children.
+ */
+struct leap_arrow_array {
+  leap_arrow_refs refs;
+  struct ArrowArray child[LEAP_ARROW_FIELDS];
+  struct ArrowArray *children[LEAP_ARROW_FIELDS];
+  const void *buffers[LEAP_ARROW_FIELDS + 1][2];
+};
+
+/*
+ * Bookkeeping for an exported schema and its children.
+ */
+struct leap_arrow_schema {
+  leap_arrow_refs refs;
+  struct ArrowSchema child[LEAP_ARROW_FIELDS];
+  struct ArrowSchema *children[LEAP_ARROW_FIELDS];
+};
+
+static inline size_t leap_arrow_align(size_t size) { return (size + 63) & ~(size_t)63; }
+
+static inline int leap_arrow_valid(const uint8_t *bits, int64_t i) {
+  return bits == NULL || (bits[i >> 3] >> (i & 7) & 1);
+}
+
+/*
+ * Validity bitmap of an input array, or null when it has no nulls.
+ */
+static inline const uint8_t *leap_arrow_bits(const struct ArrowArray *array) {
+  return array->null_count == 0 ? NULL : array->buffers[0];
+}
+
+/*
+ * Allocates a block on a 64-byte boundary. The size must be a multiple of 64.
+ */
+static inline void *leap_arrow_alloc(size_t size) {
+#ifdef _WIN32
+  return _aligned_malloc(size, 64);
+#else
+  return aligned_alloc(64, size);
+#endif
+}
+
+static inline void leap_arrow_free(void *block) {
+#ifdef _WIN32
+  _aligned_free(block);
+#else
+  free(block);
+#endif
+}
+
+static inline void leap_arrow_ref(leap_arrow_refs *refs, int n) {
+#ifdef _MSC_VER
+  *refs = n;
+#else
+  atomic_init(refs, n);
+#endif
+}
+
+/*
+ * Drops one reference to a shared block, freeing it with the last.
+ */
+static void leap_arrow_unref(leap_arrow_refs *refs, void *block) {
+#ifdef _MSC_VER
+  const bool last = _InterlockedDecrement(refs) == 0;
+#else
+  const bool last = atomic_fetch_sub_explicit(refs, 1, memory_order_acq_rel) == 1;
+#endif
+  if (last) {
+    leap_arrow_free(block);
+  }
+}
+
+static void leap_arrow_release_child(struct ArrowArray *array) {
+  struct leap_arrow_array *priv = array->private_data;
+  array->release = NULL;
+  leap_arrow_unref(&priv->refs, priv);
+}
+
+/*
+ * Releases the children still in place, then the array's own reference.
+ * Children moved out keep the block alive until released in turn.
+ */
+static void leap_arrow_release(struct ArrowArray *array) {
+  struct leap_arrow_array *priv = array->private_data;
+  for (int64_t i = 0; i < array->n_children; ++i) {
+    if (array->children[i]->release != NULL) {
+      array->children[i]->release(array->children[i]);
+    }
+  }
+  array->release = NULL;
+  leap_arrow_unref(&priv->refs, priv);
+}
+
+static void leap_arrow_release_child_schema(struct ArrowSchema *schema) {
+  struct leap_arrow_schema *priv = schema->private_data;
+  schema->release = NULL;
+  leap_arrow_unref(&priv->refs, priv);
+}
+
+static void leap_arrow_release_schema(struct ArrowSchema *schema) {
+  struct leap_arrow_schema *priv = schema->private_data;
+  for (int64_t i = 0; i < schema->n_children; ++i) {
+    if (schema->children[i]->release != NULL) {
+      schema->children[i]->release(schema->children[i]);
+    }
+  }
+  schema->release = NULL;
+  if (priv != NULL) {
+    leap_arrow_unref(&priv->refs, priv);
+  }
+}
+
+/*
+ * Answers the unit of a date or timestamp format, or -1 if unsupported.
+ */
+static int leap_arrow_unit(const char *format) {
+  if (strcmp(format, "tdD") == 0) {
+    return LEAP_ARROW_DAY;
+  }
+  if (strcmp(format, "tdm") == 0) {
+    return LEAP_ARROW_MS;
+  }
+  if (strncmp(format, "ts", 2) != 0 || format[2] == '\0' || format[3] != ':') {
+    return -1;
+  }
+  switch (format[2]) {
+  case 's':
+    return LEAP_ARROW_SEC;
+  case 'm':
+    return LEAP_ARROW_MS;
+  case 'u':
+    return LEAP_ARROW_US;
+  case 'n':
+    return LEAP_ARROW_NS;
+  default:
+    return -1;
+  }
+}
+
+/*
+ * Expands one loop per unit, flooring 64-bit values to days since 1970.
+ */
+#define LEAP_ARROW_DAYS(d)                                                                                             \
+  for (size_t j = 0; j < m; ++j) {                                                                                     \
+    day[j] = LEAP_DIV64_QUO_MOD(value[j], d).quo;                                                                      \
+  }
+
+static void leap_arrow_days(const void *data, int64_t first, size_t m, enum leap_arrow_unit unit, int64_t *day) {
+  if (unit == LEAP_ARROW_DAY) {
+    const int32_t *value = (const int32_t *)data + first;
+    for (size_t j = 0; j < m; ++j) {
+      day[j] = value[j];
+    }
+    return;
+  }
+  const int64_t *value = (const int64_t *)data + first;
+  switch (unit) {
+  case LEAP_ARROW_SEC:
+    LEAP_ARROW_DAYS(86400);
+    break;
+  case LEAP_ARROW_MS:
+    LEAP_ARROW_DAYS(86400000);
+    break;
+  case LEAP_ARROW_US:
+    LEAP_ARROW_DAYS(86400000000);
+    break;
+  default:
+    LEAP_ARROW_DAYS(86400000000000);
+  }
+}
+
+/*
+ * Fills the exported schema of the field struct.
+ */
+static void leap_arrow_fields_schema(struct leap_arrow_schema *priv, struct ArrowSchema *out) {
+  for (int k = 0; k < LEAP_ARROW_FIELDS; ++k) {
+    priv->child[k] = (struct ArrowSchema){
+        .format = "i",
+        .name = LEAP_ARROW_NAME[k],
+        .flags = ARROW_FLAG_NULLABLE,
+        .release = leap_arrow_release_child_schema,
+        .private_data = priv,
+    };
+    priv->children[k] = priv->child + k;
+  }
+  leap_arrow_ref(&priv->refs, 1 + LEAP_ARROW_FIELDS);
+  *out = (struct ArrowSchema){
+      .format = "+s",
+      .name = "",
+      .n_children = LEAP_ARROW_FIELDS,
+      .children = priv->children,
+      .release = leap_arrow_release_schema,
+      .private_data = priv,
+  };
+}
+
+int leap_arrow_fields(const struct ArrowSchema *schema, const struct ArrowArray *array,
+                      struct ArrowSchema *out_schema, struct ArrowArray *out_array) {
+  const int unit = leap_arrow_unit(schema->format);
+  if (unit < 0 || array->n_buffers != 2) {
+    return EINVAL;
+  }
+  const size_t n = (size_t)array->length;
+  const int64_t offset = array->offset;
+  const uint8_t *bits = leap_arrow_bits(array);
+  const size_t bytes = bits == NULL ? 0 : leap_arrow_align((n + 7) >> 3);
+  const size_t col = leap_arrow_align(n * sizeof(int32_t));
+  const size_t head = leap_arrow_align(sizeof(struct leap_arrow_array));
+  struct leap_arrow_array *priv = leap_arrow_alloc(head + bytes + LEAP_ARROW_FIELDS * col);
+  struct leap_arrow_schema *schema_priv = leap_arrow_alloc(leap_arrow_align(sizeof(*schema_priv)));
+  if (priv == NULL || schema_priv == NULL) {
+    leap_arrow_free(priv);
+    leap_arrow_free(schema_priv);
+    return ENOMEM;
+  }
+  uint8_t *valid = bytes == 0 ? NULL : (uint8_t *)priv + head;
+  int32_t *field[LEAP_ARROW_FIELDS];
+  for (int k = 0; k < LEAP_ARROW_FIELDS; ++k) {
+    field[k] = (int32_t *)((uint8_t *)priv + head + bytes + k * col);
+  }
+
+  /*
+   * Copies the validity bits to start at bit zero, counting nulls, then
+   * converts a block at a time. Null slots convert day zero.
+   */
+  int64_t nulls = 0;
+  if (valid != NULL) {
+    memset(valid, 0, bytes);
+    for (size_t i = 0; i < n; ++i) {
+      const int bit = leap_arrow_valid(bits, offset + (int64_t)i);
+      valid[i >> 3] |= (uint8_t)(bit << (i & 7));
+      nulls += !bit;
+    }
+  }
+  bool overflow = false;
+  for (size_t i = 0; i < n; i += LEAP_ARROW_BLOCK) {
+    const size_t m = n - i < LEAP_ARROW_BLOCK ? n - i : LEAP_ARROW_BLOCK;
+    int64_t day[LEAP_ARROW_BLOCK];
+    int abs_day[LEAP_ARROW_BLOCK], wday[LEAP_ARROW_BLOCK];
+    leap_arrow_days(array->buffers[1], offset + (int64_t)i, m, unit, day);
+    for (size_t j = 0; j < m; ++j) {
+      const int64_t d = leap_arrow_valid(bits, offset + (int64_t)(i + j)) ? day[j] : 0;
+      const bool out = d < LEAP_ABS_MIN - LEAP_MCMLXX || d > LEAP_ABS_MAX - LEAP_MCMLXX;
+      overflow |= out;
+      abs_day[j] = out ? LEAP_MCMLXX : LEAP_MCMLXX + (int)d;
+    }
+    leap_wday_n(abs_day, m, wday);
+    for (size_t j = 0; j < m; ++j) {
+      const struct leap_date date = leap_cal_date(abs_day[j]);
+      const bool null = !leap_arrow_valid(valid, (int64_t)(i + j));
+      field[0][i + j] = null ? 0 : date.year;
+      field[1][i + j] = null ? 0 : date.month;
+      field[2][i + j] = null ? 0 : date.day;
+      field[3][i + j] = null ? 0 : wday[j];
+    }
+  }
+  if (overflow) {
+    leap_arrow_free(priv);
+    leap_arrow_free(schema_priv);
+    return EOVERFLOW;
+  }
+
+  for (int k = 0; k < LEAP_ARROW_FIELDS; ++k) {
+    priv->buffers[k + 1][0] = valid;
+    priv->buffers[k + 1][1] = field[k];
+    priv->child[k] = (struct ArrowArray){
+        .length = (int64_t)n,
+        .null_count = nulls,
+        .n_buffers = 2,
+        .buffers = priv->buffers[k + 1],
+        .release = leap_arrow_release_child,
+        .private_data = priv,
+    };
+    priv->children[k] = priv->child + k;
+  }
+  leap_arrow_ref(&priv->refs, 1 + LEAP_ARROW_FIELDS);
+  priv->buffers[0][0] = NULL;
+  *out_array = (struct ArrowArray){
+      .length = (int64_t)n,
+      .n_buffers = 1,
+      .n_children = LEAP_ARROW_FIELDS,
+      .buffers = priv->buffers[0],
+      .children = priv->children,
+      .release = leap_arrow_release,
+      .private_data = priv,
+  };
+  leap_arrow_fields_schema(schema_priv, out_schema);
+  return 0;
+}
+
+int leap_arrow_dates(const struct ArrowSchema *schema, const struct ArrowArray *array, const char *format,
+                     struct ArrowSchema *out_schema, struct ArrowArray *out_array) {
+  bool wide;
+  if (strcmp(format, "tdD") == 0) {
+    wide = false;
+  } else if (strcmp(format, "tdm") == 0) {
+    wide = true;
+  } else {
+    return EINVAL;
+  }
+  if (strcmp(schema->format, "+s") != 0 || schema->n_children < 3 || array->n_children < 3) {
+    return EINVAL;
+  }
+  for (int k = 0; k < 3; ++k) {
+    if (strcmp(schema->children[k]->format, "i") != 0) {
+      return EINVAL;
+    }
+  }
+  const size_t n = (size_t)array->length;
+  const size_t bytes = leap_arrow_align((n + 7) >> 3);
+  const size_t head = leap_arrow_align(sizeof(struct leap_arrow_array));
+  struct leap_arrow_array *priv = leap_arrow_alloc(head + bytes + leap_arrow_align(n * (wide ? 8 : 4)));
+  if (priv == NULL) {
+    return ENOMEM;
+  }
+  uint8_t *valid = (uint8_t *)priv + head;
+  void *data = valid + bytes;
+  memset(valid, 0, bytes);
+
+  /*
+   * A slot is valid if valid in the struct and in every field, and if the
+   * fields make a date within the safe integer range.
+   */
+  const uint8_t *bits = leap_arrow_bits(array);
+  const uint8_t *field_bits[3];
+  const int32_t *field[3];
+  for (int k = 0; k < 3; ++k) {
+    const struct ArrowArray *child = array->children[k];
+    field_bits[k] = leap_arrow_bits(child);
+    field[k] = (const int32_t *)child->buffers[1] + child->offset + array->offset;
+  }
+  int64_t nulls = 0;
+  for (size_t i = 0; i < n; ++i) {
+    const int64_t at = array->offset + (int64_t)i;
+    int ok = leap_arrow_valid(bits, at);
+    for (int k = 0; k < 3; ++k) {
+      ok &= leap_arrow_valid(field_bits[k], array->children[k]->offset + at);
+    }
+    const int year = field[0][i], month = field[1][i], day = field[2][i];
+    ok &= year >= LEAP_YEAR_MIN && year <= LEAP_YEAR_MAX && month >= 1 && month <= 12;
+    ok = ok && day >= 1 && day <= leap_cal_mday(year, month);
+    const int days = ok ? leap_cal_from(year, month, day) - LEAP_MCMLXX : 0;
+    if (wide) {
+      ((int64_t *)data)[i] = (int64_t)days * 86400000;
+    } else {
+      ((int32_t *)data)[i] = days;
+    }
+    valid[i >> 3] |= (uint8_t)(ok << (i & 7));
+    nulls += !ok;
+  }
+
+  leap_arrow_ref(&priv->refs, 1);
+  priv->buffers[0][0] = valid;
+  priv->buffers[0][1] = data;
+  *out_array = (struct ArrowArray){
+      .length = (int64_t)n,
+      .null_count = nulls,
+      .n_buffers = 2,
+      .buffers = priv->buffers[0],
+      .release = leap_arrow_release,
+      .private_data = priv,
+  };
+  *out_schema = (struct ArrowSchema){
+      .format = wide ? "tdm" : "tdD",
+      .name = "date",
+      .flags = ARROW_FLAG_NULLABLE,
+      .release = leap_arrow_release_schema,
+  };
+  return 0;
+}
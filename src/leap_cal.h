@@ -0,0 +1,171 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_cal.h
+ * \brief Closed-form calendar arithmetic.
+ * \details Private header. Decodes absolute days without loops using the
+ * 400-year Gregorian cycle. Counting years from the first of March moves the
+ * leap day to the end of each year, so that whole four-year, century and
+ * four-century cycles fall out of plain quotients, and months fall out of a
+ * linear interpolation over the five-month 153-day pattern.
+ *
+ * Every function runs straight-line code: no loops and no early exits. Every
+ * division multiplies by a reciprocal instead, whatever the build.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#ifndef __LEAP_CAL_H__
+#define __LEAP_CAL_H__
+
+#include "leap.h"
+#include "leap_div.h"
+
+/*!
+ * \brief Absolute day of 0000-03-01.
+ * \details Thirty-one days of January plus twenty-nine of February since year 0
+ * leaps.
+ */
+#define LEAP_CAL_MAR 60
+
+/*!
+ * \brief Days in 400 Gregorian years.
+ */
+#define LEAP_CAL_ERA 146097
+
+/*!
+ * \brief March-based year and day.
+ * \details The year runs from the first of March through the end of the
+ * following February. Day 0 is the first of March; days 306 onwards fall in
+ * January and February of the following calendar year.
+ */
+struct leap_cal {
+  /*!
+   * \brief March-based year.
+   */
+  int year;
+  /*!
+   * \brief Day of the March-based year, 0 through 365.
+   */
+  int day;
+};
+
+/*!
+ * \brief March-based year and day from absolute day.
+ * \details Splits the absolute day into 400-year eras. Within an era, the day
+ * of era \c doe answers the year of era by discounting one day for each
+ * four-year cycle, adding one back for each century and discounting again for
+ * the whole era.
+ * \param abs Absolute day.
+ * \returns March-based year and day.
+ */
+static inline struct leap_cal leap_cal(int abs) {
+  const struct quo_mod era = LEAP_DIV_QUO_MOD(abs - LEAP_CAL_MAR, LEAP_CAL_ERA);
+  const int doe = era.mod;
+  const int yoe =
+      LEAP_DIV_U31(doe - LEAP_DIV_U31(doe, 1460) + LEAP_DIV_U31(doe, 36524) - LEAP_DIV_U31(doe, 146096), 365);
+  return (struct leap_cal){
+      .year = era.quo * 400 + yoe,
+      .day = doe - (365 * yoe + LEAP_DIV_U31(yoe, 4) - LEAP_DIV_U31(yoe, 100)),
+  };
+}
+
+/*!
+ * \brief Absolute day of the first of January.
+ * \details Inline equivalent of leap_day(): 365 days a year plus one for every
+ * leap year before, counting year 0.
+ * \param year Year.
+ * \returns Absolute day of the year's first day.
+ */
+static inline int leap_cal_day(int year) {
+  const int y = year - 1;
+  return year * 365 + LEAP_DIV_QUO_MOD(y, 4).quo - LEAP_DIV_QUO_MOD(y, 100).quo + LEAP_DIV_QUO_MOD(y, 400).quo + 1;
+}
+
+/*!
+ * \brief One for a leap year, otherwise zero.
+ * \details Inline, branch-free equivalent of leap_add(). Four and twenty-five
+ * factor one hundred; sixteen and twenty-five factor four hundred.
+ * \param year Year.
+ * \returns 1 for a leap year, 0 otherwise.
+ */
+static inline int leap_cal_add(int year) {
+  return ((year & 3) == 0) & (!leap_div_by25(year) | ((year & 15) == 0));
+}
+
+/*!
+ * \brief Days in a month.
+ * \details Inline equivalent of leap_mday() for months already normalised.
+ * \param year Year.
+ * \param month Month, 1 through 12.
+ * \returns Days in the month, 28 through 31.
+ */
+static inline int leap_cal_mday(int year, int month) {
+  static const int MDAY[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  return MDAY[month - 1] + (month == 2) * leap_cal_add(year);
+}
+
+/*!
+ * \brief Absolute day from date.
+ * \details Inline equivalent of leap_abs_from() for months already normalised.
+ * Days out of range carry into neighbouring months and years.
+ * \param year Year.
+ * \param month Month, 1 through 12.
+ * \param day Day of the month.
+ * \returns Absolute day.
+ */
+static inline int leap_cal_from(int year, int month, int day) {
+  static const int YDAY[] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+  return leap_cal_day(year) + YDAY[month - 1] + (month > 2) * leap_cal_add(year) + day - 1;
+}
+
+/*!
+ * \brief Days before a month, without tables.
+ * \details Interpolates months from March as leap_cal_date() does, with
+ * January and February wrapping to months ten and eleven of the year before.
+ * Neither loads nor branches, so that batch loops vectorise.
+ * \param month Month, 1 through 12.
+ * \param add One in a leap year, otherwise zero.
+ * \returns Days of the year before the first of the month.
+ */
+static inline int leap_cal_yday(int month, int add) {
+  const int mar = month > 2;
+  return LEAP_DIV_U31(153 * (month + 9 - 12 * mar) + 2, 5) + (mar ? 59 + add : -306);
+}
+
+/*!
+ * \brief Year and day of year from absolute day.
+ * \details Days 306 onwards of the March-based year belong to January and
+ * February of the next calendar year. Other days shift forward by the length
+ * of January and February, 59 or 60 days.
+ * \param abs Absolute day.
+ * \returns Normalised year and zero-based day of year.
+ */
+static inline struct leap_off leap_cal_off(int abs) {
+  const struct leap_cal cal = leap_cal(abs);
+  const int jan = cal.day >= 306;
+  return (struct leap_off){
+      .year = cal.year + jan,
+      .day = cal.day - 306 + (1 - jan) * (365 + leap_add(cal.year)),
+  };
+}
+
+/*!
+ * \brief Date from absolute day.
+ * \details Month lengths from March repeat 31, 30, 31, 30, 31: 153 days every
+ * five months. The month from March therefore interpolates linearly as
+ * <tt>(5 * day + 2) / 153</tt> and the first day of that month as
+ * <tt>(153 * month + 2) / 5</tt>.
+ * \param abs Absolute day.
+ * \returns Year, month and day of month.
+ */
+static inline struct leap_date leap_cal_date(int abs) {
+  const struct leap_cal cal = leap_cal(abs);
+  const int mp = LEAP_DIV_U31(5 * cal.day + 2, 153);
+  const int jan = mp >= 10;
+  return (struct leap_date){
+      .year = cal.year + jan,
+      .month = mp + 3 - 12 * jan,
+      .day = cal.day - LEAP_DIV_U31(153 * mp + 2, 5) + 1,
+  };
+}
+
+#endif /* __LEAP_CAL_H__ */
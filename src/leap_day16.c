@@ -0,0 +1,70 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_day16.c
+ * \brief Sixteen-bit day offset implementations.
+ * \details Implements the 16-bit day offset conversions declared in the
+ * \c leap_day16.h header file.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#include "leap_day16.h"
+#include "leap_cal.h"
+#include "leap_div.h"
+
+/*
+ * Offsets of the first of January for every year starting in the window,
+ * folded to constants at compile time for the chosen epoch.
+ */
+#define LEAP_DAY16_Y(i) (uint16_t)(LEAP_DAY16_DAY(LEAPC_DAY16_EPOCH + (i)) - LEAP_DAY16_EPOCH)
+#define LEAP_DAY16_Y10(i)                                                                                              \
+  LEAP_DAY16_Y(i), LEAP_DAY16_Y(i + 1), LEAP_DAY16_Y(i + 2), LEAP_DAY16_Y(i + 3), LEAP_DAY16_Y(i + 4),                 \
+      LEAP_DAY16_Y(i + 5), LEAP_DAY16_Y(i + 6), LEAP_DAY16_Y(i + 7), LEAP_DAY16_Y(i + 8), LEAP_DAY16_Y(i + 9)
+
+static const uint16_t LEAP_DAY16_JAN[LEAP_DAY16_YEARS] = {
+    LEAP_DAY16_Y10(0),   LEAP_DAY16_Y10(10),  LEAP_DAY16_Y10(20),  LEAP_DAY16_Y10(30),  LEAP_DAY16_Y10(40),
+    LEAP_DAY16_Y10(50),  LEAP_DAY16_Y10(60),  LEAP_DAY16_Y10(70),  LEAP_DAY16_Y10(80),  LEAP_DAY16_Y10(90),
+    LEAP_DAY16_Y10(100), LEAP_DAY16_Y10(110), LEAP_DAY16_Y10(120), LEAP_DAY16_Y10(130), LEAP_DAY16_Y10(140),
+    LEAP_DAY16_Y10(150), LEAP_DAY16_Y10(160), LEAP_DAY16_Y10(170),
+};
+
+bool leap_day16_encode(int abs_day, uint16_t *day16) {
+  const unsigned off = (unsigned)abs_day - (unsigned)LEAP_DAY16_EPOCH;
+  if (off > UINT16_MAX) {
+    return false;
+  }
+  *day16 = (uint16_t)off;
+  return true;
+}
+
+bool leap_day16_from_date(struct leap_date date, uint16_t *day16) {
+  const unsigned year = (unsigned)date.year - LEAPC_DAY16_EPOCH;
+  if (year >= LEAP_DAY16_YEARS) {
+    return false;
+  }
+  const unsigned off =
+      LEAP_DAY16_JAN[year] + (unsigned)(leap_cal_yday(date.month, leap_cal_add(date.year)) + date.day - 1);
+  if (off > UINT16_MAX) {
+    return false;
+  }
+  *day16 = (uint16_t)off;
+  return true;
+}
+
+/*
+ * Shifts the day of the year to start in March as leap_cal_date() does, with
+ * January and February at the end.
+ */
+struct leap_date leap_day16_date(uint16_t day16) {
+  int year = LEAP_DIV_U31(day16, 365);
+  year -= LEAP_DAY16_JAN[year] > day16;
+  const int add = leap_cal_add(LEAPC_DAY16_EPOCH + year);
+  const int yday = day16 - LEAP_DAY16_JAN[year];
+  const int jan = yday < 59 + add;
+  const int day = yday + (jan ? 306 : -59 - add);
+  const int mp = LEAP_DIV_U31(5 * day + 2, 153);
+  return (struct leap_date){
+      .year = LEAPC_DAY16_EPOCH + year,
+      .month = mp + 3 - 12 * jan,
+      .day = day - LEAP_DIV_U31(153 * mp + 2, 5) + 1,
+  };
+}
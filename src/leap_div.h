@@ -0,0 +1,233 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_div.h
+ * \brief Division by constants.
+ * \details Private header. Divides by the library's constant divisors using
+ * either the C division operators or, when compiled with \c LEAPC_NO_DIVIDE,
+ * multiplication by a fixed-point reciprocal and a shift.
+ *
+ * For a divisor \f$d\f$ of \f$l\f$ bits, take \f$k = 31 + l\f$ and
+ * \f$m = \lceil 2^k / d \rceil\f$. Then \f$m d - 2^k < 2^{k - 31}\f$, which
+ * makes \f$\lfloor u m / 2^k \rfloor = \lfloor u / d \rfloor\f$ exact for every
+ * \f$0 \le u < 2^{31}\f$ (Granlund and Montgomery, 1994). Every reciprocal
+ * below fits 32 bits, so the product fits 64 bits.
+ *
+ * Sixty-four-bit numerators work the same way with \f$k = 63 + l\f$ and the
+ * high half of a 128-bit product.
+ *
+ * Negative numerators floor through their ones' complement:
+ * \f$\lfloor x / d \rfloor = \lnot \lfloor \lnot x / d \rfloor\f$ for
+ * \f$x < 0\f$, where \f$\lnot x = -x - 1\f$ is non-negative.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#ifndef __LEAP_DIV_H__
+#define __LEAP_DIV_H__
+
+#include "quo_mod.h"
+
+#include <stdint.h>
+
+/*
+ * Reciprocals and shifts by divisor. Names paste the divisor's digits.
+ */
+#define LEAP_DIV_M_3 UINT64_C(0xaaaaaaab)
+#define LEAP_DIV_K_3 33
+#define LEAP_DIV_M_4 UINT64_C(0x80000000)
+#define LEAP_DIV_K_4 33
+#define LEAP_DIV_M_5 UINT64_C(0xcccccccd)
+#define LEAP_DIV_K_5 34
+#define LEAP_DIV_M_7 UINT64_C(0x92492493)
+#define LEAP_DIV_K_7 34
+#define LEAP_DIV_M_12 UINT64_C(0xaaaaaaab)
+#define LEAP_DIV_K_12 35
+#define LEAP_DIV_M_60 UINT64_C(0x88888889)
+#define LEAP_DIV_K_60 37
+#define LEAP_DIV_M_100 UINT64_C(0xa3d70a3e)
+#define LEAP_DIV_K_100 38
+#define LEAP_DIV_M_153 UINT64_C(0xd62b80d7)
+#define LEAP_DIV_K_153 39
+#define LEAP_DIV_M_365 UINT64_C(0xb38cf9b1)
+#define LEAP_DIV_K_365 40
+#define LEAP_DIV_M_400 UINT64_C(0xa3d70a3e)
+#define LEAP_DIV_K_400 40
+#define LEAP_DIV_M_1000 UINT64_C(0x83126e98)
+#define LEAP_DIV_K_1000 41
+#define LEAP_DIV_M_1460 UINT64_C(0xb38cf9b1)
+#define LEAP_DIV_K_1460 42
+#define LEAP_DIV_M_3600 UINT64_C(0x91a2b3c5)
+#define LEAP_DIV_K_3600 43
+#define LEAP_DIV_M_10000 UINT64_C(0xd1b71759)
+#define LEAP_DIV_K_10000 45
+#define LEAP_DIV_M_36524 UINT64_C(0xe5ac81fb)
+#define LEAP_DIV_K_36524 47
+#define LEAP_DIV_M_146096 UINT64_C(0xe5ac81fb)
+#define LEAP_DIV_K_146096 49
+#define LEAP_DIV_M_146097 UINT64_C(0xe5ac1af4)
+#define LEAP_DIV_K_146097 49
+
+/*
+ * Sixty-four-bit reciprocals and shifts by divisor.
+ */
+#define LEAP_DIV64_M_400 UINT64_C(0xa3d70a3d70a3d70b)
+#define LEAP_DIV64_K_400 72
+#define LEAP_DIV64_M_1000 UINT64_C(0x83126e978d4fdf3c)
+#define LEAP_DIV64_K_1000 73
+#define LEAP_DIV64_M_86400 UINT64_C(0xc22e450672894ab7)
+#define LEAP_DIV64_K_86400 80
+#define LEAP_DIV64_M_1000000 UINT64_C(0x8637bd05af6c69b6)
+#define LEAP_DIV64_K_1000000 83
+#define LEAP_DIV64_M_86400000 UINT64_C(0xc6d750ebfa67b90e)
+#define LEAP_DIV64_K_86400000 90
+#define LEAP_DIV64_M_1000000000 UINT64_C(0x89705f4136b4a598)
+#define LEAP_DIV64_K_1000000000 93
+#define LEAP_DIV64_M_86400000000 UINT64_C(0xcb9cfee55a86e25c)
+#define LEAP_DIV64_K_86400000000 100
+#define LEAP_DIV64_M_86400000000000 UINT64_C(0xd07ffede91f291c6)
+#define LEAP_DIV64_K_86400000000000 110
+
+/*!
+ * \brief Quotient of a non-negative numerator by reciprocal.
+ * \param u Numerator, 0 through \c INT_MAX.
+ * \param m Reciprocal of the divisor.
+ * \param k Shift of the reciprocal.
+ * \returns Quotient.
+ */
+static inline int leap_div_u31(int u, uint64_t m, int k) { return (int)(((uint64_t)(uint32_t)u * m) >> k); }
+
+/*!
+ * \brief Floored quotient and modulus by reciprocal.
+ * \details The sign mask \c s is all ones for negative numerators, all zeros
+ * otherwise; exclusive-or with the mask takes the ones' complement without
+ * branching.
+ * \param x Numerator, any \c int.
+ * \param d Positive divisor.
+ * \param m Reciprocal of the divisor.
+ * \param k Shift of the reciprocal.
+ * \returns Floored quotient and non-negative modulus.
+ */
+static inline struct quo_mod leap_div_quo_mod(int x, int d, uint64_t m, int k) {
+  const int s = x >> 31;
+  const int quo = s ^ leap_div_u31(s ^ x, m, k);
+  return (struct quo_mod){.quo = quo, .mod = (int)((unsigned)x - (unsigned)quo * (unsigned)d)};
+}
+
+/*!
+ * \brief Sixty-four-bit quotient and modulus.
+ * \details Like \c quo_mod but wide enough for timestamps.
+ */
+struct leap_div64 {
+  /*!
+   * \brief Sixty-four-bit quotient.
+   */
+  int64_t quo;
+  /*!
+   * \brief Sixty-four-bit modulus.
+   */
+  int64_t mod;
+};
+
+/*!
+ * \brief High half of a 128-bit product.
+ * \details Uses the compiler's 128-bit integers where they exist, otherwise
+ * sums four 32-by-32-bit partial products.
+ */
+static inline uint64_t leap_div_umulh(uint64_t a, uint64_t b) {
+#ifdef __SIZEOF_INT128__
+  return (uint64_t)(((unsigned __int128)a * b) >> 64);
+#else
+  const uint64_t a0 = (uint32_t)a, a1 = a >> 32;
+  const uint64_t b0 = (uint32_t)b, b1 = b >> 32;
+  const uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+  const uint64_t mid = (p00 >> 32) + (uint32_t)p01 + (uint32_t)p10;
+  return p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+#endif
+}
+
+/*!
+ * \brief Quotient of a non-negative 64-bit numerator by reciprocal.
+ * \param u Numerator, 0 through \c INT64_MAX.
+ * \param m Reciprocal of the divisor.
+ * \param k Shift of the reciprocal, at least 64.
+ * \returns Quotient.
+ */
+static inline int64_t leap_div_u63(int64_t u, uint64_t m, int k) {
+  return (int64_t)(leap_div_umulh((uint64_t)u, m) >> (k - 64));
+}
+
+/*!
+ * \brief Floored 64-bit quotient and modulus by reciprocal.
+ * \details Finds the modulus in unsigned arithmetic. The product of the
+ * quotient and the divisor can fall below \c INT64_MIN for numerators near it,
+ * although the modulus itself always fits.
+ * \param x Numerator, any \c int64_t.
+ * \param d Positive divisor.
+ * \param m Reciprocal of the divisor.
+ * \param k Shift of the reciprocal.
+ * \returns Floored quotient and non-negative modulus.
+ */
+static inline struct leap_div64 leap_div64_quo_mod(int64_t x, int64_t d, uint64_t m, int k) {
+  const int64_t s = x >> 63;
+  const int64_t quo = s ^ leap_div_u63(s ^ x, m, k);
+  return (struct leap_div64){.quo = quo, .mod = (int64_t)((uint64_t)x - (uint64_t)quo * (uint64_t)d)};
+}
+
+/*!
+ * \brief Tests divisibility by 25.
+ * \details Multiplies the magnitude by the inverse of 25 modulo \f$2^{32}\f$.
+ * Multiples of 25 map onto 0 through \f$\lfloor (2^{32} - 1) / 25 \rfloor\f$;
+ * all other numbers map above (Lemire, Kaser and Kurz, 2019).
+ * \param x Number to test.
+ * \returns Non-zero if 25 divides \c x.
+ */
+static inline int leap_div_by25(int x) {
+  const uint32_t s = (uint32_t)(x >> 31);
+  return (((uint32_t)x ^ s) - s) * UINT32_C(0xc28f5c29) <= UINT32_C(171798691);
+}
+
+/*!
+ * \brief Floored quotient and modulus by constant reciprocal.
+ * \param x Numerator.
+ * \param d Constant divisor having a reciprocal above.
+ */
+#define LEAP_DIV_QUO_MOD(x, d) LEAP_DIV_QUO_MOD_(x, d)
+#define LEAP_DIV_QUO_MOD_(x, d) leap_div_quo_mod((x), (d), LEAP_DIV_M_##d, LEAP_DIV_K_##d)
+
+/*!
+ * \brief Quotient of non-negative numerator by constant reciprocal.
+ * \param x Non-negative numerator.
+ * \param d Constant divisor having a reciprocal above.
+ */
+#define LEAP_DIV_U31(x, d) LEAP_DIV_U31_(x, d)
+#define LEAP_DIV_U31_(x, d) leap_div_u31((x), LEAP_DIV_M_##d, LEAP_DIV_K_##d)
+
+/*!
+ * \brief Floored 64-bit quotient and modulus by constant reciprocal.
+ * \param x Sixty-four-bit numerator.
+ * \param d Constant divisor having a 64-bit reciprocal above.
+ */
+#define LEAP_DIV64_QUO_MOD(x, d) LEAP_DIV64_QUO_MOD_(x, d)
+#define LEAP_DIV64_QUO_MOD_(x, d) leap_div64_quo_mod((x), INT64_C(d), LEAP_DIV64_M_##d, LEAP_DIV64_K_##d)
+
+/*!
+ * \brief Quotient of non-negative 64-bit numerator by constant reciprocal.
+ * \param x Non-negative 64-bit numerator.
+ * \param d Constant divisor having a 64-bit reciprocal above.
+ */
+#define LEAP_DIV64_U63(x, d) LEAP_DIV64_U63_(x, d)
+#define LEAP_DIV64_U63_(x, d) leap_div_u63((x), LEAP_DIV64_M_##d, LEAP_DIV64_K_##d)
+
+/*
+ * Division as the build prefers: by operator unless dividing is out.
+ */
+#ifdef LEAPC_NO_DIVIDE
+
+#define LEAP_QUO_MOD(x, d) LEAP_DIV_QUO_MOD(x, d)
+
+#else
+
+#define LEAP_QUO_MOD(x, d) quo_mod((x), (d))
+
+#endif /* LEAPC_NO_DIVIDE */
+
+#endif /* __LEAP_DIV_H__ */
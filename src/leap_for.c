@@ -0,0 +1,214 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_for.c
+ * \brief Day column compression implementations.
+ * \details Implements the compressed day columns declared in the
+ * \c leap_for.h header file.
+ *
+ * Each block starts with three words: the smallest day, the largest day and
+ * an information word holding the bit width in its low byte, a delta flag in
+ * the next bit and the number of days from bit sixteen. Packed values follow in
+ * four interleaved lanes: value \c i belongs to lane <tt>i % 4</tt>, and word
+ * \c j of lane \c l sits at <tt>4 * j + l</tt>. Each lane packs its 32 values
+ * least significant bit first, continuing across word boundaries, in
+ * \c width words. The four lanes therefore share every word index and shift,
+ * so unpacking moves four values at a time through vector registers without
+ * any gather. One word of padding per lane lets unpacking always read two
+ * words. Blocks of width zero, days all equal, store no packed words at all;
+ * short blocks pack zeros after their last day.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#include "leap_for.h"
+#include "leap_cal.h"
+
+#include <string.h>
+
+/*
+ * Delta flag in the information word.
+ */
+#define LEAP_FOR_DELTA 0x100U
+
+/*
+ * Bits needed for an unsigned value.
+ */
+static inline unsigned leap_for_width(uint32_t bits) {
+  unsigned width = 0;
+  while (width < 32 && bits >> width != 0) {
+    ++width;
+  }
+  return width;
+}
+
+/*
+ * Words of packed values plus padding.
+ */
+static inline size_t leap_for_words(unsigned width) { return width == 0 ? 0 : 4 * (size_t)width + 4; }
+
+static void leap_for_pack(const uint32_t *value, unsigned width, uint32_t *out) {
+  memset(out, 0, leap_for_words(width) * sizeof(*out));
+  for (unsigned k = 0; k < LEAP_FOR_BLOCK / 4; ++k) {
+    const unsigned bit = k * width;
+    const unsigned shift = bit & 31;
+    uint32_t *word = out + 4 * (bit >> 5);
+    for (unsigned l = 0; l < 4; ++l) {
+      word[l] |= value[4 * k + l] << shift;
+      word[l + 4] |= value[4 * k + l] >> 1 >> (31 - shift);
+    }
+  }
+}
+
+/*
+ * Joins each value from two adjacent words of its lane. Shifting the upper
+ * word left by one and then by 31 less the shift avoids shifting by 32 when
+ * the value starts on a word boundary.
+ */
+static void leap_for_unpack(const uint32_t *in, unsigned width, uint32_t *value) {
+  if (width == 0) {
+    memset(value, 0, LEAP_FOR_BLOCK * sizeof(*value));
+    return;
+  }
+  const uint32_t mask = (uint32_t)((UINT64_C(1) << width) - 1);
+  for (unsigned k = 0; k < LEAP_FOR_BLOCK / 4; ++k) {
+    const unsigned bit = k * width;
+    const unsigned shift = bit & 31;
+    const uint32_t *word = in + 4 * (bit >> 5);
+    for (unsigned l = 0; l < 4; ++l) {
+      value[4 * k + l] = (word[l] >> shift | word[l + 4] << 1 << (31 - shift)) & mask;
+    }
+  }
+}
+
+size_t leap_for_encode(const int *abs_day, size_t n, uint32_t *out) {
+  size_t at = 0;
+  out[at++] = (uint32_t)n;
+  for (size_t i = 0; i < n; i += LEAP_FOR_BLOCK) {
+    const size_t m = n - i < LEAP_FOR_BLOCK ? n - i : LEAP_FOR_BLOCK;
+    const int *day = abs_day + i;
+    int min = day[0], max = day[0];
+    uint32_t gaps = 0;
+    bool sorted = true;
+    for (size_t j = 1; j < m; ++j) {
+      min = day[j] < min ? day[j] : min;
+      max = day[j] > max ? day[j] : max;
+      sorted &= day[j] >= day[j - 1];
+      gaps |= (uint32_t)day[j] - (uint32_t)day[j - 1];
+    }
+    const unsigned range = leap_for_width((uint32_t)max - (uint32_t)min);
+    const unsigned width = sorted ? leap_for_width(gaps) : range;
+    const bool delta = sorted && width < range;
+    uint32_t value[LEAP_FOR_BLOCK] = {0};
+    for (size_t j = 0; j < m; ++j) {
+      value[j] = (uint32_t)day[j] - (delta && j > 0 ? (uint32_t)day[j - 1] : (uint32_t)min);
+    }
+    out[at++] = (uint32_t)min;
+    out[at++] = (uint32_t)max;
+    out[at++] = (delta ? width : range) | (delta ? LEAP_FOR_DELTA : 0) | (uint32_t)m << 16;
+    leap_for_pack(value, delta ? width : range, out + at);
+    at += leap_for_words(delta ? width : range);
+  }
+  return at;
+}
+
+size_t leap_for_count(const uint32_t *in) { return in[0]; }
+
+/*
+ * Unpacks one block to absolute days, answering the next block. Adds deltas up
+ * from the smallest day, the first day of a delta block; adds the smallest day
+ * to every value otherwise.
+ */
+static const uint32_t *leap_for_block(const uint32_t *in, int *day, size_t *m) {
+  const uint32_t min = in[0];
+  const unsigned width = in[2] & 0xff;
+  *m = in[2] >> 16;
+  uint32_t value[LEAP_FOR_BLOCK];
+  leap_for_unpack(in + 3, width, value);
+  if (in[2] & LEAP_FOR_DELTA) {
+    uint32_t sum = min;
+    for (size_t j = 0; j < *m; ++j) {
+      sum += value[j];
+      day[j] = (int)sum;
+    }
+  } else {
+    for (size_t j = 0; j < *m; ++j) {
+      day[j] = (int)(min + value[j]);
+    }
+  }
+  return in + 3 + leap_for_words(width);
+}
+
+void leap_for_decode(const uint32_t *in, int *abs_day) {
+  const size_t n = in[0];
+  ++in;
+  for (size_t i = 0, m; i < n; i += m) {
+    in = leap_for_block(in, abs_day + i, &m);
+  }
+}
+
+void leap_for_decode_date(const uint32_t *in, struct leap_date *date) {
+  const size_t n = in[0];
+  ++in;
+  for (size_t i = 0, m; i < n; i += m) {
+    int day[LEAP_FOR_BLOCK];
+    in = leap_for_block(in, day, &m);
+    for (size_t j = 0; j < m; ++j) {
+      date[i + j] = leap_cal_date(day[j]);
+    }
+  }
+}
+
+/*
+ * Month runs in progress. Days from first up to but not including next fall
+ * in the month of the last run; first exceeds next before the first run.
+ */
+struct leap_for_runs {
+  struct leap_year_month *month;
+  size_t *count;
+  size_t max;
+  size_t runs;
+  int first;
+  int next;
+};
+
+/*
+ * Adds days falling in the month of the given day to the runs, extending the
+ * last run or starting another.
+ */
+static void leap_for_run(struct leap_for_runs *runs, int abs_day, size_t days) {
+  if (abs_day >= runs->first && abs_day < runs->next) {
+    if (runs->runs <= runs->max) {
+      runs->count[runs->runs - 1] += days;
+    }
+    return;
+  }
+  const struct leap_date date = leap_cal_date(abs_day);
+  runs->first = abs_day - date.day + 1;
+  runs->next = runs->first + leap_cal_mday(date.year, date.month);
+  if (runs->runs < runs->max) {
+    runs->month[runs->runs] = (struct leap_year_month){date.year, date.month};
+    runs->count[runs->runs] = days;
+  }
+  ++runs->runs;
+}
+
+size_t leap_for_month_runs(const uint32_t *in, struct leap_year_month *month, size_t *count, size_t max) {
+  struct leap_for_runs runs = {month, count, max, 0, 1, 0};
+  const size_t n = in[0];
+  ++in;
+  for (size_t i = 0, m; i < n; i += m) {
+    const int min = (int)in[0];
+    const struct leap_date date = leap_cal_date(min);
+    if (in[1] - in[0] <= (uint32_t)(leap_cal_mday(date.year, date.month) - date.day)) {
+      m = in[2] >> 16;
+      leap_for_run(&runs, min, m);
+      in += 3 + leap_for_words(in[2] & 0xff);
+      continue;
+    }
+    int day[LEAP_FOR_BLOCK];
+    in = leap_for_block(in, day, &m);
+    for (size_t j = 0; j < m; ++j) {
+      leap_for_run(&runs, day[j], 1);
+    }
+  }
+  return runs.runs;
+}
@@ -0,0 +1,513 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_format.c
+ * \brief Compiled date format implementations.
+ * \details Implements the format compiler, the compiled-format parsers and
+ * formatters, and the ISO 8601 formatters declared in the \c leap_format.h header file.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#include "leap_format.h"
+#include "leap_cal.h"
+#include "leap_div.h"
+#include "leap_time.h"
+#include "leap_wday.h"
+
+#include <string.h>
+
+/*
+ * English month names. The C locale's names, whatever the current locale.
+ */
+static const char *const LEAP_FORMAT_MON[] = {"january", "february", "march",     "april",   "may",      "june",
+                                              "july",    "august",   "september", "october", "november", "december"};
+
+/*
+ * English weekday names from Sunday, the order of leap_wday().
+ */
+static const char *const LEAP_FORMAT_WDAY[] = {"sunday",   "monday", "tuesday", "wednesday",
+                                               "thursday", "friday", "saturday"};
+
+bool leap_format_compile(struct leap_format *format, const char *spec) {
+  int n = 0;
+  for (const char *at = spec; *at != '\0'; ++at) {
+    if (n == LEAP_FORMAT_OPS) {
+      return false;
+    }
+    uint8_t op;
+    char ch = *at;
+    if (ch == ' ' || ch == '\t') {
+      op = LEAP_FORMAT_SPACE;
+    } else if (ch != '%') {
+      op = LEAP_FORMAT_LIT;
+    } else {
+      switch (ch = *++at) {
+      case 'Y':
+        op = LEAP_FORMAT_YEAR;
+        break;
+      case 'y':
+        op = LEAP_FORMAT_YEAR2;
+        break;
+      case 'm':
+        op = LEAP_FORMAT_MONTH;
+        break;
+      case 'd':
+      case 'e':
+        op = LEAP_FORMAT_MDAY;
+        break;
+      case 'j':
+        op = LEAP_FORMAT_YDAY;
+        break;
+      case 'b':
+      case 'h':
+      case 'B':
+        op = LEAP_FORMAT_MON_NAME;
+        break;
+      case 'a':
+      case 'A':
+        op = LEAP_FORMAT_WDAY_NAME;
+        break;
+      case 'H':
+        op = LEAP_FORMAT_HOUR;
+        break;
+      case 'M':
+        op = LEAP_FORMAT_MIN;
+        break;
+      case 'S':
+        op = LEAP_FORMAT_SEC;
+        break;
+      case '%':
+        op = LEAP_FORMAT_LIT;
+        break;
+      default:
+        return false;
+      }
+    }
+    format->op[n] = op;
+    format->ch[n] = ch;
+    ++n;
+  }
+  format->n = n;
+  return true;
+}
+
+/*
+ * Reads one to max decimal digits, answering -1 if none.
+ */
+static int leap_format_number(const char *text, size_t len, size_t *at, int max) {
+  int value = 0;
+  const size_t first = *at;
+  while (*at < len && *at - first < (size_t)max && (unsigned)((unsigned char)text[*at] - '0') <= 9) {
+    value = value * 10 + (text[(*at)++] - '0');
+  }
+  return *at == first ? -1 : value;
+}
+
+/*
+ * Reads a time-of-day field of one or two digits, answering -1 if none or if
+ * above max.
+ */
+static int leap_format_clock(const char *text, size_t len, size_t *at, int max) {
+  const int value = leap_format_number(text, len, at, 2);
+  return value > max ? -1 : value;
+}
+
+/*
+ * Matches an abbreviated or full English name in any letter case, answering
+ * its index plus one, or -1 if none matches. Folds letters to lower case by
+ * setting bit five, which leaves only letters matching letters.
+ */
+static int leap_format_name(const char *text, size_t len, size_t *at, const char *const *names, int count) {
+  if (len - *at < 3) {
+    return -1;
+  }
+  for (int index = 0; index < count; ++index) {
+    const char *name = names[index];
+    size_t i = 0;
+    while (i < 3 && (text[*at + i] | 0x20) == name[i]) {
+      ++i;
+    }
+    if (i < 3) {
+      continue;
+    }
+    while (name[i] != '\0' && *at + i < len && (text[*at + i] | 0x20) == name[i]) {
+      ++i;
+    }
+    *at += name[i] == '\0' ? i : 3;
+    return index + 1;
+  }
+  return -1;
+}
+
+/*
+ * Runs a compiled format over the text, answering true with a valid date if it
+ * matches the whole text.
+ */
+static bool leap_format_run(const struct leap_format *format, const char *text, size_t len, struct leap_date *date) {
+  int year = 0, month = 1, day = 1, yday = 0, skip = 0;
+  bool julian = false;
+  size_t at = 0;
+  for (int i = 0; i < format->n; ++i) {
+    switch (format->op[i]) {
+    case LEAP_FORMAT_LIT:
+      if (at == len || text[at] != format->ch[i]) {
+        return false;
+      }
+      ++at;
+      break;
+    case LEAP_FORMAT_SPACE:
+      while (at < len && (text[at] == ' ' || text[at] == '\t')) {
+        ++at;
+      }
+      break;
+    case LEAP_FORMAT_YEAR:
+      year = leap_format_number(text, len, &at, 4);
+      break;
+    case LEAP_FORMAT_YEAR2:
+      year = leap_format_number(text, len, &at, 2);
+      year += year < 0 ? 0 : year < 69 ? 2000 : 1900;
+      break;
+    case LEAP_FORMAT_MONTH:
+      month = leap_format_number(text, len, &at, 2);
+      break;
+    case LEAP_FORMAT_MDAY:
+      while (at < len && text[at] == ' ') {
+        ++at;
+      }
+      day = leap_format_number(text, len, &at, 2);
+      break;
+    case LEAP_FORMAT_YDAY:
+      yday = leap_format_number(text, len, &at, 3);
+      julian = true;
+      break;
+    case LEAP_FORMAT_MON_NAME:
+      month = leap_format_name(text, len, &at, LEAP_FORMAT_MON, 12);
+      break;
+    case LEAP_FORMAT_WDAY_NAME:
+      skip = leap_format_name(text, len, &at, LEAP_FORMAT_WDAY, 7);
+      break;
+    case LEAP_FORMAT_HOUR:
+      skip = leap_format_clock(text, len, &at, 23);
+      break;
+    case LEAP_FORMAT_MIN:
+      skip = leap_format_clock(text, len, &at, 59);
+      break;
+    default:
+      skip = leap_format_clock(text, len, &at, 60);
+    }
+    if ((year | month | day | yday | skip) < 0) {
+      return false;
+    }
+  }
+  if (at != len) {
+    return false;
+  }
+  if (julian) {
+    if (yday < 1 || yday > 365 + leap_cal_add(year)) {
+      return false;
+    }
+    *date = leap_cal_date(leap_cal_day(year) + yday - 1);
+    return true;
+  }
+  if (month < 1 || month > 12 || day < 1 || day > leap_cal_mday(year, month)) {
+    return false;
+  }
+  *date = (struct leap_date){.year = year, .month = month, .day = day};
+  return true;
+}
+
+bool leap_parse_compiled(const struct leap_format *format, const char *text, size_t len, struct leap_date *date) {
+  return leap_format_run(format, text, len, date);
+}
+
+size_t leap_parse_compiled_n(const struct leap_format *format, const char *const *text, const size_t *len, size_t n,
+                             int *abs_day, uint64_t *invalid) {
+  uint64_t word = 0;
+  size_t count = 0;
+  for (size_t i = 0; i < n; ++i) {
+    struct leap_date date;
+    const int bad = !leap_format_run(format, text[i], len[i], &date);
+    abs_day[i] = bad ? 0 : leap_cal_from(date.year, date.month, date.day);
+    word |= (uint64_t)bad << (i & 63);
+    count += (size_t)bad;
+    if ((i & 63) == 63 || i == n - 1) {
+      invalid[i >> 6] = word;
+      word = 0;
+    }
+  }
+  return count;
+}
+
+/*!
+ * \brief Timestamps per batch block.
+ */
+#define LEAP_FORMAT_BLOCK 256
+
+/*
+ * Decimal digit pairs, 00 through 99: two characters for every number below
+ * one hundred.
+ */
+static const char LEAP_FORMAT_PAIRS[200] = "00010203040506070809"
+                                           "10111213141516171819"
+                                           "20212223242526272829"
+                                           "30313233343536373839"
+                                           "40414243444546474849"
+                                           "50515253545556575859"
+                                           "60616263646566676869"
+                                           "70717273747576777879"
+                                           "80818283848586878889"
+                                           "90919293949596979899";
+
+/*
+ * Stores two digits, 00 through 99, with one fixed-width copy.
+ */
+static inline void leap_format_pair(char *out, int value) { memcpy(out, LEAP_FORMAT_PAIRS + 2 * value, 2); }
+
+static inline void leap_format_date(char *out, struct leap_date date) {
+  const int century = LEAP_DIV_U31(date.year, 100);
+  leap_format_pair(out, century);
+  leap_format_pair(out + 2, date.year - century * 100);
+  out[4] = '-';
+  leap_format_pair(out + 5, date.month);
+  out[7] = '-';
+  leap_format_pair(out + 8, date.day);
+}
+
+static inline void leap_format_time(char *out, struct leap_time time) {
+  leap_format_date(out, time.date);
+  out[10] = 'T';
+  leap_format_pair(out + 11, time.hour);
+  out[13] = ':';
+  leap_format_pair(out + 14, time.min);
+  out[16] = ':';
+  leap_format_pair(out + 17, time.sec);
+}
+
+/*
+ * Nine fractional digits split into four pairs and one leading digit, each
+ * pair by reciprocal division by one hundred.
+ */
+static inline void leap_format_ns(char *out, int ns) {
+  for (int i = 7; i > 0; i -= 2) {
+    const int quo = LEAP_DIV_U31(ns, 100);
+    leap_format_pair(out + i, ns - quo * 100);
+    ns = quo;
+  }
+  out[0] = (char)('0' + ns);
+}
+
+/*
+ * Four-digit years bound the fixed-width forms. Days and times beyond them
+ * saturate to the first or last instant, since the digit pairs cover no more.
+ */
+static const struct leap_time LEAP_FORMAT_FIRST = {{0, 1, 1}, 0, 0, 0, 0};
+static const struct leap_time LEAP_FORMAT_LAST = {{9999, 12, 31}, 23, 59, 59, 999999999};
+
+static inline int leap_format_clamp(int abs_day) {
+  return abs_day < 0 ? 0 : abs_day > LEAP_FORMAT_ABS_MAX ? LEAP_FORMAT_ABS_MAX : abs_day;
+}
+
+static inline struct leap_time leap_format_clamp_time(struct leap_time time) {
+  return time.date.year < 0 ? LEAP_FORMAT_FIRST : time.date.year > 9999 ? LEAP_FORMAT_LAST : time;
+}
+
+void leap_format_iso(int abs_day, char out[LEAP_FORMAT_ISO]) {
+  leap_format_date(out, leap_cal_date(leap_format_clamp(abs_day)));
+}
+
+/*
+ * Seconds reach far beyond the safe range, so check the day before decoding.
+ */
+void leap_format_iso_time(int64_t sec, int epoch, char out[LEAP_FORMAT_ISO_TIME]) {
+  const int64_t abs_day = epoch + LEAP_DIV64_QUO_MOD(sec, 86400).quo;
+  const struct leap_time time = abs_day < 0                     ? LEAP_FORMAT_FIRST
+                                : abs_day > LEAP_FORMAT_ABS_MAX ? LEAP_FORMAT_LAST
+                                                                : leap_time(sec, epoch);
+  leap_format_time(out, time);
+  out[19] = 'Z';
+}
+
+void leap_format_iso_time_ns(int64_t ns, int epoch, char out[LEAP_FORMAT_ISO_TIME_NS]) {
+  const struct leap_time time = leap_format_clamp_time(leap_time_ns(ns, epoch));
+  leap_format_time(out, time);
+  out[19] = '.';
+  leap_format_ns(out + 20, time.subsec);
+  out[29] = 'Z';
+}
+
+size_t leap_format_iso_n(const int *abs_day, size_t n, char *out, size_t stride) {
+  size_t clamped = 0;
+  for (size_t i = 0; i < n; ++i) {
+    const int day = leap_format_clamp(abs_day[i]);
+    clamped += day != abs_day[i];
+    leap_format_date(out + i * stride, leap_cal_date(day));
+  }
+  return clamped;
+}
+
+/*
+ * Decodes each block of timestamps into field columns in one batch, then
+ * formats the block from the columns.
+ */
+size_t leap_format_iso_time_ns_n(const int64_t *ns, size_t n, int epoch, char *out, size_t stride) {
+  int year[LEAP_FORMAT_BLOCK], month[LEAP_FORMAT_BLOCK], day[LEAP_FORMAT_BLOCK];
+  int hour[LEAP_FORMAT_BLOCK], min[LEAP_FORMAT_BLOCK], sec[LEAP_FORMAT_BLOCK], nsec[LEAP_FORMAT_BLOCK];
+  const struct leap_time_cols cols = {year, month, day, hour, min, sec, nsec};
+  size_t clamped = 0;
+  for (size_t i = 0; i < n; i += LEAP_FORMAT_BLOCK) {
+    const size_t m = n - i < LEAP_FORMAT_BLOCK ? n - i : LEAP_FORMAT_BLOCK;
+    leap_time_ns_n(ns + i, m, epoch, &cols);
+    for (size_t j = 0; j < m; ++j) {
+      char *at = out + (i + j) * stride;
+      const struct leap_time time =
+          leap_format_clamp_time((struct leap_time){{year[j], month[j], day[j]}, hour[j], min[j], sec[j], nsec[j]});
+      clamped += time.date.year != year[j];
+      leap_format_time(at, time);
+      at[19] = '.';
+      leap_format_ns(at + 20, time.subsec);
+      at[29] = 'Z';
+    }
+  }
+  return clamped;
+}
+
+/*
+ * Writes a name capitalised, in full or abbreviated to three letters.
+ */
+static inline int leap_format_title(char *out, const char *name, bool full) {
+  int i = 0;
+  out[i++] = (char)(name[0] & ~0x20);
+  while (name[i] != '\0' && (full || i < 3)) {
+    out[i] = name[i];
+    ++i;
+  }
+  return i;
+}
+
+/*
+ * Renders one operation into at most nine characters, answering how many.
+ */
+static int leap_format_put(uint8_t op, char ch, struct leap_time time, int yday, int wday, char *out) {
+  int value;
+  switch (op) {
+  case LEAP_FORMAT_LIT:
+  case LEAP_FORMAT_SPACE:
+    out[0] = ch;
+    return 1;
+  case LEAP_FORMAT_YEAR:
+    value = LEAP_DIV_U31(time.date.year, 100);
+    leap_format_pair(out, value);
+    leap_format_pair(out + 2, time.date.year - value * 100);
+    return 4;
+  case LEAP_FORMAT_YEAR2:
+    value = time.date.year - LEAP_DIV_U31(time.date.year, 100) * 100;
+    break;
+  case LEAP_FORMAT_MONTH:
+    value = time.date.month;
+    break;
+  case LEAP_FORMAT_MDAY:
+    leap_format_pair(out, time.date.day);
+    if (ch == 'e' && out[0] == '0') {
+      out[0] = ' ';
+    }
+    return 2;
+  case LEAP_FORMAT_YDAY:
+    value = LEAP_DIV_U31(yday, 100);
+    out[0] = (char)('0' + value);
+    leap_format_pair(out + 1, yday - value * 100);
+    return 3;
+  case LEAP_FORMAT_MON_NAME:
+    return leap_format_title(out, LEAP_FORMAT_MON[time.date.month - 1], ch == 'B');
+  case LEAP_FORMAT_WDAY_NAME:
+    return leap_format_title(out, LEAP_FORMAT_WDAY[wday], ch == 'A');
+  case LEAP_FORMAT_HOUR:
+    value = time.hour;
+    break;
+  case LEAP_FORMAT_MIN:
+    value = time.min;
+    break;
+  default:
+    value = time.sec;
+  }
+  leap_format_pair(out, value);
+  return 2;
+}
+
+/*
+ * Renders operations first up to but not including last, answering the number
+ * of characters or -1 if they do not fit in size.
+ */
+static int leap_format_render(const struct leap_format *format, int first, int last, struct leap_time time, int yday,
+                              int wday, char *out, size_t size) {
+  char put[9];
+  size_t at = 0;
+  for (int i = first; i < last; ++i) {
+    const int n = leap_format_put(format->op[i], format->ch[i], time, yday, wday, put);
+    if (size - at < (size_t)n) {
+      return -1;
+    }
+    memcpy(out + at, put, (size_t)n);
+    at += (size_t)n;
+  }
+  return (int)at;
+}
+
+size_t leap_format_compiled(const struct leap_format *format, int abs_day, char *out, size_t size) {
+  if (size == 0 || abs_day < 0 || abs_day > LEAP_FORMAT_ABS_MAX) {
+    return 0;
+  }
+  const struct leap_date date = leap_cal_date(abs_day);
+  const int yday = abs_day - leap_cal_day(date.year) + 1;
+  const int len =
+      leap_format_render(format, 0, format->n, (struct leap_time){.date = date}, yday, leap_wday(abs_day), out, size - 1);
+  if (len < 0) {
+    return 0;
+  }
+  out[len] = '\0';
+  return (size_t)len;
+}
+
+/*
+ * Time-of-day operations close the operation codes, so the split falls at the
+ * first code from hour onwards.
+ */
+void leap_format_cache_init(struct leap_format_cache *cache, const struct leap_format *format) {
+  int split = 0;
+  while (split < format->n && format->op[split] < LEAP_FORMAT_HOUR) {
+    ++split;
+  }
+  cache->format = *format;
+  cache->split = split;
+  cache->len = -1;
+}
+
+size_t leap_format_cached(struct leap_format_cache *cache, int64_t sec, int epoch, char *out, size_t size) {
+  const struct leap_div64 day = LEAP_DIV64_QUO_MOD(sec, 86400);
+  if (epoch + day.quo < 0 || epoch + day.quo > LEAP_FORMAT_ABS_MAX) {
+    return 0;
+  }
+  const int abs_day = epoch + (int)day.quo;
+  if (cache->len < 0 || cache->day != abs_day) {
+    cache->day = abs_day;
+    cache->date = leap_cal_date(abs_day);
+    cache->yday = abs_day - leap_cal_day(cache->date.year) + 1;
+    cache->wday = leap_wday(abs_day);
+    cache->len = leap_format_render(&cache->format, 0, cache->split, (struct leap_time){.date = cache->date},
+                                    cache->yday, cache->wday, cache->prefix, sizeof(cache->prefix));
+  }
+  if (size <= (size_t)cache->len) {
+    return 0;
+  }
+  const int sod = (int)day.mod;
+  const int hour = LEAP_DIV_U31(sod, 3600);
+  const int soh = sod - hour * 3600;
+  const int min = LEAP_DIV_U31(soh, 60);
+  const struct leap_time time = {cache->date, hour, min, soh - min * 60, 0};
+  memcpy(out, cache->prefix, (size_t)cache->len);
+  const int len = leap_format_render(&cache->format, cache->split, cache->format.n, time, cache->yday, cache->wday,
+                                     out + cache->len, size - 1 - (size_t)cache->len);
+  if (len < 0) {
+    return 0;
+  }
+  out[cache->len + len] = '\0';
+  return (size_t)(cache->len + len);
+}
@@ -0,0 +1,55 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_iso.c
+ * \brief ISO 8601 week-date function implementations.
+ * \details Implements the week-date conversions declared in the \c leap_iso.h
+ * header file.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#include "leap_iso.h"
+#include "leap_cal.h"
+#include "leap_div.h"
+#include "leap_wday.h"
+
+/*
+ * ISO day of the week, Monday 1 through Sunday 7. Sunday, day 0 counting from
+ * Sunday, wraps round to day 7.
+ */
+static inline int leap_iso_wday(int abs_day) { return LEAP_DIV_QUO_MOD(abs_day + LEAP_WDAY0 - 1, 7).mod + 1; }
+
+static inline struct leap_iso leap_iso_cal(int abs_day) {
+  const int wday = leap_iso_wday(abs_day);
+  const struct leap_off thu = leap_cal_off(abs_day - wday + 4);
+  return (struct leap_iso){.year = thu.year, .week = LEAP_DIV_U31(thu.day, 7) + 1, .wday = wday};
+}
+
+static inline int leap_iso_cal_from(int year, int week, int wday) {
+  const int jan4 = leap_cal_day(year) + 3;
+  return jan4 - leap_iso_wday(jan4) + 7 * (week - 1) + wday;
+}
+
+struct leap_iso leap_iso_week(int abs_day) { return leap_iso_cal(abs_day); }
+
+int leap_iso_from(int year, int week, int wday) { return leap_iso_cal_from(year, week, wday); }
+
+void leap_iso_week_n(const int *abs_day, size_t n, const struct leap_iso_cols *cols) {
+  for (size_t i = 0; i < n; ++i) {
+    const struct leap_iso iso = leap_iso_cal(abs_day[i]);
+    if (cols->year != NULL) {
+      cols->year[i] = iso.year;
+    }
+    if (cols->week != NULL) {
+      cols->week[i] = iso.week;
+    }
+    if (cols->wday != NULL) {
+      cols->wday[i] = iso.wday;
+    }
+  }
+}
+
+void leap_iso_from_n(const struct leap_iso_cols *cols, size_t n, int *abs_day) {
+  for (size_t i = 0; i < n; ++i) {
+    abs_day[i] = leap_iso_cal_from(cols->year[i], cols->week[i], cols->wday[i]);
+  }
+}
@@ -0,0 +1,78 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_key.c
+ * \brief Integer date key implementations.
+ * \details Implements the date key conversions declared in the \c leap_key.h
+ * header file.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#include "leap_key.h"
+#include "leap_cal.h"
+#include "leap_div.h"
+
+/*
+ * Splits a key into year, month and day, then validates them without
+ * branching. Clamps negative keys to zero and bad months to January so that
+ * the arithmetic stays in range whatever the key, then masks the answer.
+ *
+ * Computes month lengths and days before the month rather than looking them
+ * up, so that batches vectorise without gathers. Months other than February
+ * alternate 31 and 30 days, switching phase after July.
+ */
+static inline int leap_key_abs(int32_t key, int *bad) {
+  const int k = key < 0 ? 0 : key;
+  const int year = LEAP_DIV_U31(k, 10000);
+  const int md = k - year * 10000;
+  const int month = LEAP_DIV_U31(md, 100);
+  const int day = md - month * 100;
+  const int ok_month = (unsigned)(month - 1) < 12;
+  const int m = ok_month ? month : 1;
+  const int add = leap_cal_add(year);
+  const int mday = m == 2 ? 28 + add : 30 | ((m ^ m >> 3) & 1);
+  const int ok = (key >= 0) & ok_month & (day >= 1) & (day <= mday);
+  *bad = !ok;
+  return ok ? leap_cal_day(year) + leap_cal_yday(m, add) + day - 1 : 0;
+}
+
+static inline int32_t leap_key_from_abs(int abs_day) {
+  const int ok = (abs_day >= 0) & (abs_day <= LEAP_YMD_KEY_ABS_MAX);
+  const struct leap_date date = leap_cal_date(ok ? abs_day : 0);
+  return ok ? date.year * 10000 + date.month * 100 + date.day : -1;
+}
+
+bool leap_ymd_key_to_abs(int32_t key, int *abs_day) {
+  int bad;
+  const int day = leap_key_abs(key, &bad);
+  if (bad) {
+    return false;
+  }
+  *abs_day = day;
+  return true;
+}
+
+int32_t leap_abs_to_ymd_key(int abs_day) { return leap_key_from_abs(abs_day); }
+
+size_t leap_ymd_key_to_abs_n(const int32_t *key, size_t n, int *abs_day, uint64_t *invalid) {
+  size_t count = 0;
+  for (size_t i = 0; i < n; i += 64) {
+    const size_t m = n - i < 64 ? n - i : 64;
+    int bad[64];
+    for (size_t j = 0; j < m; ++j) {
+      abs_day[i + j] = leap_key_abs(key[i + j], bad + j);
+    }
+    uint64_t word = 0;
+    for (size_t j = 0; j < m; ++j) {
+      word |= (uint64_t)bad[j] << j;
+      count += (size_t)bad[j];
+    }
+    invalid[i >> 6] = word;
+  }
+  return count;
+}
+
+void leap_abs_to_ymd_key_n(const int *abs_day, size_t n, int32_t *key) {
+  for (size_t i = 0; i < n; ++i) {
+    key[i] = leap_key_from_abs(abs_day[i]);
+  }
+}
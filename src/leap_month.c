@@ -0,0 +1,128 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_month.c
+ * \brief Calendar month arithmetic implementations.
+ * \details Implements the month and year addition and the calendar differences
+ * declared in the \c leap_month.h header file.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#include "leap_month.h"
+#include "leap_cal.h"
+#include "leap_div.h"
+
+/*
+ * Lands a day of the month in the given year and month, any month carrying
+ * into years. The day's original month length decides whether the day sits
+ * at the end of its month. Overflow carries at most three days, since no month
+ * runs shorter than 28 days and none longer than 31, and never out of
+ * December, which has 31 days; a single step into the next month always
+ * suffices.
+ */
+static inline struct leap_date leap_month_land(int year, int month, int day, int mday0, enum leap_eom eom) {
+  const struct quo_mod qm = LEAP_DIV_QUO_MOD(month - 1, 12);
+  year += qm.quo;
+  month = qm.mod + 1;
+  const int mday = leap_cal_mday(year, month);
+  switch (eom) {
+  case LEAP_EOM_OVERFLOW: {
+    const int over = day > mday;
+    return (struct leap_date){.year = year, .month = month + over, .day = day - over * mday};
+  }
+  case LEAP_EOM_STICK:
+    day = day == mday0 ? mday : day;
+    /* FALLTHROUGH */
+  default:
+    return (struct leap_date){.year = year, .month = month, .day = day < mday ? day : mday};
+  }
+}
+
+struct leap_date leap_add_months(struct leap_date date, int months, enum leap_eom eom) {
+  return leap_month_land(date.year, date.month + months, date.day, leap_cal_mday(date.year, date.month), eom);
+}
+
+struct leap_date leap_add_years(struct leap_date date, int years, enum leap_eom eom) {
+  return leap_month_land(date.year + years, date.month, date.day, leap_cal_mday(date.year, date.month), eom);
+}
+
+void leap_add_months_n(const int *abs_day, size_t n, int months, enum leap_eom eom, int *result) {
+  for (size_t i = 0; i < n; ++i) {
+    const struct leap_date date = leap_cal_date(abs_day[i]);
+    const struct leap_date land =
+        leap_month_land(date.year, date.month + months, date.day, leap_cal_mday(date.year, date.month), eom);
+    result[i] = leap_cal_from(land.year, land.month, land.day);
+  }
+}
+
+/*
+ * Counts the whole months from one day to another no earlier, answering the
+ * days left over. Adding the difference in calendar months can overshoot: by
+ * one month when the earlier day of the month exceeds the later, and by one
+ * more when overflowing carries the first landing into the later month. At
+ * most two steps back undo the overshoot; clamping and sticking never need the
+ * second.
+ */
+static inline int leap_month_diff(struct leap_date from, int to_abs, struct leap_date to, enum leap_eom eom,
+                                  int *days) {
+  const int mday0 = leap_cal_mday(from.year, from.month);
+  int months = (to.year - from.year) * 12 + to.month - from.month;
+  struct leap_date land = leap_month_land(from.year, from.month + months, from.day, mday0, eom);
+  int land_abs = leap_cal_from(land.year, land.month, land.day);
+  for (int step = 0; step < 2; ++step) {
+    const int over = land_abs > to_abs;
+    months -= over;
+    land = leap_month_land(from.year, from.month + months, from.day, mday0, eom);
+    land_abs = leap_cal_from(land.year, land.month, land.day);
+  }
+  *days = to_abs - land_abs;
+  return months;
+}
+
+/*
+ * Orders the pair, counts forward from the earlier day and negates the counts
+ * when the pair arrived in reverse.
+ */
+static inline struct leap_diff leap_month_diff_abs(int from_abs, struct leap_date from, int to_abs,
+                                                   struct leap_date to, enum leap_eom eom) {
+  const int neg = to_abs < from_abs;
+  const int sign = 1 - 2 * neg;
+  int days;
+  const int months =
+      neg ? leap_month_diff(to, from_abs, from, eom, &days) : leap_month_diff(from, to_abs, to, eom, &days);
+  const struct quo_mod qm = LEAP_DIV_QUO_MOD(months, 12);
+  return (struct leap_diff){.years = sign * qm.quo, .months = sign * qm.mod, .days = sign * days};
+}
+
+int leap_months_between(struct leap_date from, struct leap_date to, enum leap_eom eom) {
+  const struct leap_diff diff = leap_diff(from, to, eom);
+  return diff.years * 12 + diff.months;
+}
+
+struct leap_diff leap_diff(struct leap_date from, struct leap_date to, enum leap_eom eom) {
+  return leap_month_diff_abs(leap_cal_from(from.year, from.month, from.day), from,
+                             leap_cal_from(to.year, to.month, to.day), to, eom);
+}
+
+void leap_months_between_n(const int *from, const int *to, size_t n, enum leap_eom eom, int *months) {
+  for (size_t i = 0; i < n; ++i) {
+    const struct leap_diff diff =
+        leap_month_diff_abs(from[i], leap_cal_date(from[i]), to[i], leap_cal_date(to[i]), eom);
+    months[i] = diff.years * 12 + diff.months;
+  }
+}
+
+void leap_diff_n(const int *from, const int *to, size_t n, enum leap_eom eom, const struct leap_diff_cols *cols) {
+  for (size_t i = 0; i < n; ++i) {
+    const struct leap_diff diff =
+        leap_month_diff_abs(from[i], leap_cal_date(from[i]), to[i], leap_cal_date(to[i]), eom);
+    if (cols->years != NULL) {
+      cols->years[i] = diff.years;
+    }
+    if (cols->months != NULL) {
+      cols->months[i] = diff.months;
+    }
+    if (cols->days != NULL) {
+      cols->days[i] = diff.days;
+    }
+  }
+}
@@ -0,0 +1,36 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_pack.c
+ * \brief Packed date implementations.
+ * \details Implements the absolute-day conversions declared in the
+ * \c leap_pack.h header file.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#include "leap_pack.h"
+#include "leap_cal.h"
+
+/*
+ * Finds days before the month by arithmetic rather than by table so that
+ * batches vectorise.
+ */
+static inline int leap_pack_from(uint32_t packed) {
+  const struct leap_date date = leap_unpack(packed);
+  return leap_cal_day(date.year) + leap_cal_yday(date.month, leap_cal_add(date.year)) + date.day - 1;
+}
+
+uint32_t leap_abs_pack(int abs_day) { return leap_pack(leap_cal_date(abs_day)); }
+
+int leap_pack_abs(uint32_t packed) { return leap_pack_from(packed); }
+
+void leap_abs_pack_n(const int *abs_day, size_t n, uint32_t *packed) {
+  for (size_t i = 0; i < n; ++i) {
+    packed[i] = leap_pack(leap_cal_date(abs_day[i]));
+  }
+}
+
+void leap_pack_abs_n(const uint32_t *packed, size_t n, int *abs_day) {
+  for (size_t i = 0; i < n; ++i) {
+    abs_day[i] = leap_pack_from(packed[i]);
+  }
+}
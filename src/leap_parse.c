@@ -0,0 +1,301 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_parse.c
+ * \brief Date parsing implementations.
+ * \details Implements the parsers declared in the \c leap_parse.h header file.
+ *
+ * Parsers work on eight characters at once within a 64-bit word, the first
+ * character in the lowest byte, using plain integer arithmetic: SIMD within a
+ * register. Subtracting '0' from every byte answers the digits. Multiplying by
+ * ten and adding the word shifted down by one byte combines neighbouring
+ * digits, so that every other byte holds a two-digit number: century, year of
+ * century, month and day.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#include "leap_parse.h"
+#include "leap_cal.h"
+
+#include <string.h>
+
+/*
+ * One in every byte.
+ */
+#define LEAP_PARSE_ONES UINT64_C(0x0101010101010101)
+
+/*
+ * Loads eight characters, the first in the lowest byte, whatever the byte
+ * order of the machine. Compilers reduce the shifts to a single load on
+ * little-endian machines.
+ */
+static inline uint64_t leap_parse_load8(const char *text) {
+  const unsigned char *u = (const unsigned char *)text;
+  return (uint64_t)u[0] | (uint64_t)u[1] << 8 | (uint64_t)u[2] << 16 | (uint64_t)u[3] << 24 | (uint64_t)u[4] << 32 |
+         (uint64_t)u[5] << 40 | (uint64_t)u[6] << 48 | (uint64_t)u[7] << 56;
+}
+
+/*
+ * Loads two characters, the first in the lower byte.
+ */
+static inline uint64_t leap_parse_load2(const char *text) {
+  const unsigned char *u = (const unsigned char *)text;
+  return (uint64_t)u[0] | (uint64_t)u[1] << 8;
+}
+
+/*
+ * Answers non-zero if all eight bytes hold decimal digits, '0' through '9'.
+ * Digits share the high nibble 3, and adding 6 keeps it there only for '0'
+ * through '9'.
+ */
+static inline int leap_parse_digits8(uint64_t chars) {
+  const uint64_t high = LEAP_PARSE_ONES * 0xf0;
+  return ((chars & high) == LEAP_PARSE_ONES * 0x30) & (((chars + LEAP_PARSE_ONES * 6) & high) == LEAP_PARSE_ONES * 0x30);
+}
+
+/*
+ * Combines eight digit characters into four two-digit numbers, one in the low
+ * byte of every 16-bit lane.
+ */
+static inline uint64_t leap_parse_pairs8(uint64_t chars) {
+  const uint64_t digits = chars - LEAP_PARSE_ONES * '0';
+  return (digits * 10 + (digits >> 8)) & UINT64_C(0x00ff00ff00ff00ff);
+}
+
+/*
+ * Answers the absolute day of eight calendar-date digits, YYYYMMDD, or
+ * absolute day 0 with *bad set when the digits fail to make a date. Valid or
+ * not, every field takes the same path.
+ */
+static inline int leap_parse_ymd(uint64_t chars, int *bad) {
+  const uint64_t pairs = leap_parse_pairs8(chars);
+  const int year = (int)(pairs & 0xff) * 100 + (int)(pairs >> 16 & 0xff);
+  const int month = (int)(pairs >> 32 & 0xff);
+  const int day = (int)(pairs >> 48);
+  const int month_ok = (month >= 1) & (month <= 12);
+  const int safe_month = month_ok ? month : 1;
+  const int ok = leap_parse_digits8(chars) & month_ok & (day >= 1) & (day <= leap_cal_mday(year, safe_month));
+  *bad = !ok;
+  return ok * leap_cal_from(year, safe_month, day);
+}
+
+/*
+ * Answers the absolute day of eight ordinal-date characters, YYYY0DDD with
+ * the hyphen already replaced by a zero digit.
+ */
+static inline int leap_parse_yd(uint64_t chars, int *bad) {
+  const uint64_t pairs = leap_parse_pairs8(chars);
+  const int year = (int)(pairs & 0xff) * 100 + (int)(pairs >> 16 & 0xff);
+  const int day = (int)(pairs >> 32 & 0xff) * 100 + (int)(pairs >> 48);
+  const int ok = leap_parse_digits8(chars) & (day >= 1) & (day <= 365 + leap_cal_add(year));
+  *bad = !ok;
+  return ok * (leap_cal_day(year) + day - 1);
+}
+
+/*
+ * Parses an extended calendar date. Drops the two hyphens to leave eight
+ * digits: YYYY and MM from the first eight characters, DD from the last two.
+ */
+static inline int leap_parse_extended(const char *text, int *bad) {
+  const uint64_t head = leap_parse_load8(text);
+  const uint64_t chars = (head & UINT64_C(0xffffffff)) | (head >> 8 & UINT64_C(0xffff00000000)) |
+                         leap_parse_load2(text + 8) << 48;
+  const int hyphens = (head >> 32 & 0xff) == '-' && (head >> 56) == '-';
+  const int abs_day = leap_parse_ymd(chars, bad);
+  *bad |= !hyphens;
+  return hyphens * abs_day;
+}
+
+static inline int leap_parse_basic(const char *text, int *bad) { return leap_parse_ymd(leap_parse_load8(text), bad); }
+
+/*
+ * Parses an extended ordinal date, swapping the hyphen for a zero.
+ */
+static inline int leap_parse_ordinal(const char *text, int *bad) {
+  const uint64_t head = leap_parse_load8(text);
+  const int hyphen = (head >> 32 & 0xff) == '-';
+  const int abs_day = leap_parse_yd(head ^ (uint64_t)('-' ^ '0') << 32, bad);
+  *bad |= !hyphen;
+  return hyphen * abs_day;
+}
+
+bool leap_parse_iso_date(const char *text, enum leap_iso_date form, int *abs_day) {
+  int bad;
+  int day;
+  switch (form) {
+  case LEAP_ISO_DATE_EXTENDED:
+    day = leap_parse_extended(text, &bad);
+    break;
+  case LEAP_ISO_DATE_BASIC:
+    day = leap_parse_basic(text, &bad);
+    break;
+  default:
+    day = leap_parse_ordinal(text, &bad);
+  }
+  if (bad) {
+    return false;
+  }
+  *abs_day = day;
+  return true;
+}
+
+/*
+ * Expands one loop per form. Gathers invalid bits into a word and stores the
+ * word after every 64 fields and after the last.
+ */
+#define LEAP_PARSE_N(parse)                                                                                            \
+  for (size_t i = 0; i < n; ++i) {                                                                                     \
+    int bad;                                                                                                           \
+    abs_day[i] = parse(text + i * stride, &bad);                                                                       \
+    word |= (uint64_t)bad << (i & 63);                                                                                 \
+    count += (size_t)bad;                                                                                              \
+    if ((i & 63) == 63 || i == n - 1) {                                                                                \
+      invalid[i >> 6] = word;                                                                                          \
+      word = 0;                                                                                                        \
+    }                                                                                                                  \
+  }
+
+size_t leap_parse_iso_date_n(const char *text, size_t stride, size_t n, enum leap_iso_date form, int *abs_day,
+                             uint64_t *invalid) {
+  uint64_t word = 0;
+  size_t count = 0;
+  switch (form) {
+  case LEAP_ISO_DATE_EXTENDED:
+    LEAP_PARSE_N(leap_parse_extended);
+    break;
+  case LEAP_ISO_DATE_BASIC:
+    LEAP_PARSE_N(leap_parse_basic);
+    break;
+  default:
+    LEAP_PARSE_N(leap_parse_ordinal);
+  }
+  return count;
+}
+
+/*
+ * Nanoseconds per second.
+ */
+#define LEAP_PARSE_NS INT64_C(1000000000)
+
+/*
+ * Parses two digits, answering -1 for anything else.
+ */
+static inline int leap_parse_2(const char *text) {
+  const unsigned tens = (unsigned char)text[0] - '0';
+  const unsigned units = (unsigned char)text[1] - '0';
+  return tens <= 9 && units <= 9 ? (int)(tens * 10 + units) : -1;
+}
+
+/*
+ * Parses HH:MM:SS, eight characters, as a second of the day up to 86400
+ * inclusive for a leap second at the very end of the day. Moves the colon-
+ * separated pairs into adjacent lanes with "00" in the top lane, then reuses
+ * the date lanes: hours, minutes, seconds.
+ */
+static inline int leap_parse_hms(const char *text) {
+  const uint64_t head = leap_parse_load8(text);
+  const uint64_t chars = (head & 0xffff) | (head >> 24 & 0xffff) << 16 | (head >> 48) << 32 | UINT64_C(0x3030) << 48;
+  const uint64_t pairs = leap_parse_pairs8(chars);
+  const int hour = (int)(pairs & 0xff);
+  const int min = (int)(pairs >> 16 & 0xff);
+  const int sec = (int)(pairs >> 32 & 0xff);
+  const int ok = leap_parse_digits8(chars) & ((head >> 16 & 0xff) == ':') & ((head >> 40 & 0xff) == ':') &
+                 (hour <= 23) & (min <= 59) & (sec <= 60);
+  return ok ? hour * 3600 + min * 60 + sec : -1;
+}
+
+/*
+ * Scales each count of fractional digits up to nanoseconds.
+ */
+static const int32_t LEAP_PARSE_FRAC[] = {1000000000, 100000000, 10000000, 1000000, 100000, 10000, 1000, 100, 10, 1};
+
+bool leap_parse_rfc3339(const char *text, size_t len, int epoch, int64_t *ns) {
+  /*
+   * The shortest timestamp runs to twenty characters: the date, a separator,
+   * the time and a Z.
+   */
+  if (len < 20) {
+    return false;
+  }
+  int bad;
+  const int abs_day = leap_parse_extended(text, &bad);
+  const char t = text[10];
+  if (bad || (t != 'T' && t != 't' && t != ' ')) {
+    return false;
+  }
+  const int sod = leap_parse_hms(text + 11);
+  if (sod < 0) {
+    return false;
+  }
+  size_t at = 19;
+  int32_t frac = 0;
+  if (text[at] == '.') {
+    const size_t first = ++at;
+    while (at < len && (unsigned)((unsigned char)text[at] - '0') <= 9) {
+      if (at - first < 9) {
+        frac = frac * 10 + (text[at] - '0');
+      }
+      ++at;
+    }
+    const size_t digits = at - first;
+    if (digits == 0) {
+      return false;
+    }
+    frac *= LEAP_PARSE_FRAC[digits < 9 ? digits : 9];
+  }
+  int off = 0;
+  if (at + 1 == len && (text[at] == 'Z' || text[at] == 'z')) {
+    ++at;
+  } else if (at + 6 == len && (text[at] == '+' || text[at] == '-') && text[at + 3] == ':') {
+    const int hour = leap_parse_2(text + at + 1);
+    const int min = leap_parse_2(text + at + 4);
+    if (hour < 0 || hour > 23 || min < 0 || min > 59) {
+      return false;
+    }
+    off = (hour * 60 + min) * 60;
+    off = text[at] == '-' ? -off : off;
+    at += 6;
+  } else {
+    return false;
+  }
+
+  /*
+   * Checks that the nanoseconds fit 64 bits before multiplying. The bounds
+   * fold to constants at compile time.
+   */
+  const int64_t sec = ((int64_t)abs_day - epoch) * 86400 + sod - off;
+  const int64_t hi = INT64_MAX / LEAP_PARSE_NS, lo = INT64_MIN / LEAP_PARSE_NS;
+  if (sec > hi || (sec == hi && frac > INT64_MAX % LEAP_PARSE_NS) || sec < lo - 1 ||
+      (sec == lo - 1 && frac < LEAP_PARSE_NS + INT64_MIN % LEAP_PARSE_NS)) {
+    return false;
+  }
+  *ns = (int64_t)((uint64_t)sec * (uint64_t)LEAP_PARSE_NS + (uint64_t)frac);
+  return true;
+}
+
+size_t leap_parse_rfc3339_n(const char *text, size_t len, char delim, int epoch, int64_t *ns, uint64_t *invalid,
+                            size_t n, size_t *used) {
+  size_t i = 0, at = 0;
+  uint64_t word = 0;
+  for (; i < n; ++i) {
+    const char *end = memchr(text + at, delim, len - at);
+    if (end == NULL) {
+      break;
+    }
+    size_t record = (size_t)(end - (text + at));
+    record -= record > 0 && text[at + record - 1] == '\r';
+    int64_t t = 0;
+    const int bad = !leap_parse_rfc3339(text + at, record, epoch, &t);
+    ns[i] = t;
+    word |= (uint64_t)bad << (i & 63);
+    if ((i & 63) == 63) {
+      invalid[i >> 6] = word;
+      word = 0;
+    }
+    at = (size_t)(end - text) + 1;
+  }
+  if ((i & 63) != 0) {
+    invalid[i >> 6] = word;
+  }
+  *used = at;
+  return i;
+}
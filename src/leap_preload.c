@@ -0,0 +1,29 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_preload.c
+ * \brief C library interposition.
+ * \details Defines the C library's \c gmtime_r, \c gmtime and \c timegm
+ * functions in terms of leapc. Build into a shared object and preload it so
+ * that existing programs pick up leapc without rebuilding:
+ * \code
+ * LD_PRELOAD=libleapc_preload.so legacy-service
+ * \endcode
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#define _DEFAULT_SOURCE
+
+#include "leap_tm.h"
+
+struct tm *gmtime_r(const time_t *timep, struct tm *result) { return leap_gmtime_r(timep, result); }
+
+/*
+ * The C library shares one static buffer between gmtime() and localtime().
+ * Give each thread its own instead.
+ */
+struct tm *gmtime(const time_t *timep) {
+  static _Thread_local struct tm tm;
+  return leap_gmtime_r(timep, &tm);
+}
+
+time_t timegm(struct tm *tm) { return leap_timegm(tm); }
@@ -0,0 +1,26 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_stats.c
+ * \brief Leap statistics counter implementations.
+ * \details Implements the snapshot and reset functions declared in the
+ * \c leap_stats.h header file.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#include "leap_stats.h"
+
+#ifdef LEAPC_STATS
+
+LEAP_STATS_THREAD struct leap_stats leap_stats_tls;
+
+struct leap_stats leap_stats_snapshot(void) { return leap_stats_tls; }
+
+void leap_stats_reset(void) { leap_stats_tls = (struct leap_stats){0}; }
+
+#else
+
+struct leap_stats leap_stats_snapshot(void) { return (struct leap_stats){0}; }
+
+void leap_stats_reset(void) {}
+
+#endif /* LEAPC_STATS */
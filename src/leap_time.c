@@ -0,0 +1,130 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_time.c
+ * \brief Leap time function implementations.
+ * \details Implements the timestamp conversions declared in the
+ * \c leap_time.h header file.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#include "leap_time.h"
+#include "leap_cal.h"
+#include "leap_div.h"
+
+/*!
+ * \brief Timestamps per batch block.
+ * \details Sizes the block's scratch columns to sit comfortably in level-one
+ * cache.
+ */
+#define LEAP_TIME_BLOCK 256
+
+/*
+ * Splits the second of the day into hours, minutes and seconds and decodes the
+ * day. Every conversion shares this once it has split its timestamp into days
+ * and a time of day: one 64-bit floored division per timestamp, whatever its
+ * units, then narrow divisions from there on.
+ */
+static inline struct leap_time leap_time_sod(int day, int sod, int subsec) {
+  const int hour = LEAP_DIV_U31(sod, 3600);
+  const int soh = sod - hour * 3600;
+  const int min = LEAP_DIV_U31(soh, 60);
+  return (struct leap_time){
+      .date = leap_cal_date(day),
+      .hour = hour,
+      .min = min,
+      .sec = soh - min * 60,
+      .subsec = subsec,
+  };
+}
+
+struct leap_time leap_time(int64_t sec, int epoch) {
+  const struct leap_div64 day = LEAP_DIV64_QUO_MOD(sec, 86400);
+  return leap_time_sod(epoch + (int)day.quo, (int)day.mod, 0);
+}
+
+struct leap_time leap_time_ms(int64_t ms, int epoch) {
+  const struct leap_div64 day = LEAP_DIV64_QUO_MOD(ms, 86400000);
+  const int sod = LEAP_DIV_U31((int)day.mod, 1000);
+  return leap_time_sod(epoch + (int)day.quo, sod, (int)day.mod - sod * 1000);
+}
+
+struct leap_time leap_time_us(int64_t us, int epoch) {
+  const struct leap_div64 day = LEAP_DIV64_QUO_MOD(us, 86400000000);
+  const int sod = (int)LEAP_DIV64_U63(day.mod, 1000000);
+  return leap_time_sod(epoch + (int)day.quo, sod, (int)(day.mod - sod * INT64_C(1000000)));
+}
+
+struct leap_time leap_time_ns(int64_t ns, int epoch) {
+  const struct leap_div64 day = LEAP_DIV64_QUO_MOD(ns, 86400000000000);
+  const int sod = (int)LEAP_DIV64_U63(day.mod, 1000000000);
+  return leap_time_sod(epoch + (int)day.quo, sod, (int)(day.mod - sod * INT64_C(1000000000)));
+}
+
+int64_t leap_time_from(struct leap_time time, int epoch) {
+  const int64_t day = (int64_t)leap_abs_from_date(time.date) - epoch;
+  return day * 86400 + (int64_t)time.hour * 3600 + (int64_t)time.min * 60 + time.sec;
+}
+
+void leap_time_ns_n(const int64_t *ns, size_t n, int epoch, const struct leap_time_cols *cols) {
+  const bool date = cols->year != NULL || cols->month != NULL || cols->day != NULL;
+  const bool time = cols->hour != NULL || cols->min != NULL || cols->sec != NULL || cols->nsec != NULL;
+  int days[LEAP_TIME_BLOCK];
+  int64_t nsods[LEAP_TIME_BLOCK];
+  for (size_t i = 0; i < n; i += LEAP_TIME_BLOCK) {
+    const size_t m = n - i < LEAP_TIME_BLOCK ? n - i : LEAP_TIME_BLOCK;
+    for (size_t j = 0; j < m; ++j) {
+      const struct leap_div64 day = LEAP_DIV64_QUO_MOD(ns[i + j], 86400000000000);
+      days[j] = epoch + (int)day.quo;
+      nsods[j] = day.mod;
+    }
+    if (date) {
+      for (size_t j = 0; j < m; ++j) {
+        const struct leap_date leap = leap_cal_date(days[j]);
+        if (cols->year != NULL) {
+          cols->year[i + j] = leap.year;
+        }
+        if (cols->month != NULL) {
+          cols->month[i + j] = leap.month;
+        }
+        if (cols->day != NULL) {
+          cols->day[i + j] = leap.day;
+        }
+      }
+    }
+    if (time) {
+      for (size_t j = 0; j < m; ++j) {
+        const int sod = (int)LEAP_DIV64_U63(nsods[j], 1000000000);
+        const int hour = LEAP_DIV_U31(sod, 3600);
+        const int soh = sod - hour * 3600;
+        const int min = LEAP_DIV_U31(soh, 60);
+        if (cols->hour != NULL) {
+          cols->hour[i + j] = hour;
+        }
+        if (cols->min != NULL) {
+          cols->min[i + j] = min;
+        }
+        if (cols->sec != NULL) {
+          cols->sec[i + j] = soh - min * 60;
+        }
+        if (cols->nsec != NULL) {
+          cols->nsec[i + j] = (int)(nsods[j] - sod * INT64_C(1000000000));
+        }
+      }
+    }
+  }
+}
+
+/*
+ * Scales seconds and adds the fraction. Unsigned arithmetic wraps harmlessly
+ * where the scaled seconds overflow but the sum does not, as happens for the
+ * earliest 64-bit nanosecond timestamps.
+ */
+static inline int64_t leap_time_scale(struct leap_time time, int epoch, uint64_t scale) {
+  return (int64_t)((uint64_t)leap_time_from(time, epoch) * scale + (uint64_t)(int64_t)time.subsec);
+}
+
+int64_t leap_time_from_ms(struct leap_time time, int epoch) { return leap_time_scale(time, epoch, 1000U); }
+
+int64_t leap_time_from_us(struct leap_time time, int epoch) { return leap_time_scale(time, epoch, 1000000U); }
+
+int64_t leap_time_from_ns(struct leap_time time, int epoch) { return leap_time_scale(time, epoch, 1000000000U); }
@@ -0,0 +1,85 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_tm.c
+ * \brief Standard broken-down time implementations.
+ * \details Implements the \c gmtime_r and \c timegm replacements declared in
+ * the \c leap_tm.h header file.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+/*
+ * Ask the C library for the offset and zone members of struct tm.
+ */
+#define _DEFAULT_SOURCE
+
+#include "leap_tm.h"
+#include "leap.h"
+#include "leap_cal.h"
+#include "leap_div.h"
+#include "leap_wday.h"
+
+#include <errno.h>
+#include <stdint.h>
+
+struct tm *leap_gmtime_r(const time_t *timep, struct tm *result) {
+  const struct leap_div64 day = LEAP_DIV64_QUO_MOD((int64_t)*timep, 86400);
+  if (day.quo < (int64_t)LEAP_ABS_MIN - LEAP_MCMLXX || day.quo > (int64_t)LEAP_ABS_MAX - LEAP_MCMLXX) {
+    errno = EOVERFLOW;
+    return NULL;
+  }
+  const int abs = LEAP_MCMLXX + (int)day.quo;
+  const int sod = (int)day.mod;
+  const int hour = LEAP_DIV_U31(sod, 3600);
+  const int soh = sod - hour * 3600;
+  const int min = LEAP_DIV_U31(soh, 60);
+  const struct leap_date date = leap_cal_date(abs);
+  result->tm_sec = soh - min * 60;
+  result->tm_min = min;
+  result->tm_hour = hour;
+  result->tm_mday = date.day;
+  result->tm_mon = date.month - 1;
+  result->tm_year = date.year - 1900;
+  result->tm_wday = leap_wday(abs);
+  result->tm_yday = leap_cal_off(abs).day;
+  result->tm_isdst = 0;
+#ifdef LEAPC_HAVE_TM_GMTOFF
+  result->tm_gmtoff = 0;
+#endif
+#ifdef LEAPC_HAVE_TM_ZONE
+  result->tm_zone = "GMT";
+#endif
+  return result;
+}
+
+time_t leap_timegm(struct tm *tm) {
+  /*
+   * Carry seconds, minutes and hours into days, and months into years, using
+   * 64 bits throughout so that no field overflows on the way.
+   */
+  const int64_t secs = (int64_t)tm->tm_hour * 3600 + (int64_t)tm->tm_min * 60 + tm->tm_sec;
+  const struct leap_div64 day = LEAP_DIV64_QUO_MOD(secs, 86400);
+  const struct quo_mod mon = LEAP_DIV_QUO_MOD(tm->tm_mon, 12);
+  const int64_t year = (int64_t)tm->tm_year + 1900 + mon.quo;
+
+  /*
+   * The year may lie beyond the safe range even though the day of the month
+   * carries the date back within it. Count the year's days within its 400-year
+   * era, where nothing overflows, then add whole eras of 146,097 days each.
+   */
+  const struct leap_div64 era = LEAP_DIV64_QUO_MOD(year, 400);
+  const int yoe = (int)era.mod;
+  const int64_t abs = era.quo * LEAP_CAL_ERA + leap_day(yoe) + leap_yday(yoe, mon.mod + 1) + (int64_t)tm->tm_mday - 1 +
+                      day.quo;
+  if (abs < LEAP_ABS_MIN || abs > LEAP_ABS_MAX) {
+    errno = EOVERFLOW;
+    return (time_t)-1;
+  }
+  const int64_t t = (abs - LEAP_MCMLXX) * 86400 + day.mod;
+  if ((int64_t)(time_t)t != t) {
+    errno = EOVERFLOW;
+    return (time_t)-1;
+  }
+  const time_t time = (time_t)t;
+  (void)leap_gmtime_r(&time, tm);
+  return time;
+}
@@ -0,0 +1,127 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_trunc.c
+ * \brief Time-bucket truncation implementations.
+ * \details Implements the truncations declared in the \c leap_trunc.h header
+ * file. Months, quarters and years work from the March-based day of year:
+ * the first day of the month holding a March-based day interpolates as
+ * <tt>(153 * month + 2) / 5</tt>, and only the calendar year's January and
+ * February straddle two March-based years.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#include "leap_trunc.h"
+#include "leap_cal.h"
+#include "leap_div.h"
+#include "leap_wday.h"
+
+/*!
+ * \brief Timestamps per batch block.
+ */
+#define LEAP_TRUNC_BLOCK 256
+
+static inline int leap_trunc_week(int abs_day) {
+  return abs_day - LEAP_DIV_QUO_MOD(abs_day + LEAP_WDAY0 - 1, 7).mod;
+}
+
+static inline int leap_trunc_month(int abs_day) {
+  const struct leap_cal cal = leap_cal(abs_day);
+  const int mp = LEAP_DIV_U31(5 * cal.day + 2, 153);
+  return abs_day - cal.day + LEAP_DIV_U31(153 * mp + 2, 5);
+}
+
+/*
+ * March-based months 10, 11 and 0 make up the first quarter: January and
+ * February ending one March-based year, March starting the next. March
+ * therefore steps back over the previous March-based year's January and
+ * February, 59 days, plus the leap day that ends the year if any.
+ */
+static inline int leap_trunc_quarter(int abs_day) {
+  const struct leap_cal cal = leap_cal(abs_day);
+  const int mp = LEAP_DIV_U31(5 * cal.day + 2, 153);
+  const int k = mp + 2 - LEAP_DIV_U31(mp + 2, 3) * 3;
+  const int mar = mp == 0;
+  return abs_day - cal.day + LEAP_DIV_U31(153 * (mp - k + 12 * mar) + 2, 5) - mar * (365 + leap_cal_add(cal.year));
+}
+
+/*
+ * January starts at March-based day 306 of the previous March-based year.
+ */
+static inline int leap_trunc_year(int abs_day) {
+  const struct leap_cal cal = leap_cal(abs_day);
+  const int jan = cal.day >= 306;
+  return abs_day - cal.day + jan * 306 - (1 - jan) * (59 + leap_cal_add(cal.year));
+}
+
+int leap_trunc(int abs_day, enum leap_unit unit) {
+  switch (unit) {
+  case LEAP_UNIT_WEEK:
+    return leap_trunc_week(abs_day);
+  case LEAP_UNIT_MONTH:
+    return leap_trunc_month(abs_day);
+  case LEAP_UNIT_QUARTER:
+    return leap_trunc_quarter(abs_day);
+  case LEAP_UNIT_YEAR:
+    return leap_trunc_year(abs_day);
+  default:
+    return abs_day;
+  }
+}
+
+int64_t leap_trunc_time(int64_t sec, int epoch, enum leap_unit unit) {
+  const struct leap_div64 day = LEAP_DIV64_QUO_MOD(sec, 86400);
+  return (int64_t)(leap_trunc(epoch + (int)day.quo, unit) - epoch) * 86400;
+}
+
+int64_t leap_trunc_time_ns(int64_t ns, int epoch, enum leap_unit unit) {
+  const struct leap_div64 day = LEAP_DIV64_QUO_MOD(ns, 86400000000000);
+  return (int64_t)((uint64_t)(leap_trunc(epoch + (int)day.quo, unit) - epoch) * UINT64_C(86400000000000));
+}
+
+/*
+ * Expands one straight-line loop per unit so that the unit's truncation
+ * inlines into its loop.
+ */
+#define LEAP_TRUNC_N(trunc)                                                                                            \
+  for (size_t i = 0; i < n; ++i) {                                                                                     \
+    result[i] = trunc(abs_day[i]);                                                                                     \
+  }
+
+void leap_trunc_n(const int *abs_day, size_t n, enum leap_unit unit, int *result) {
+  switch (unit) {
+  case LEAP_UNIT_WEEK:
+    LEAP_TRUNC_N(leap_trunc_week);
+    break;
+  case LEAP_UNIT_MONTH:
+    LEAP_TRUNC_N(leap_trunc_month);
+    break;
+  case LEAP_UNIT_QUARTER:
+    LEAP_TRUNC_N(leap_trunc_quarter);
+    break;
+  case LEAP_UNIT_YEAR:
+    LEAP_TRUNC_N(leap_trunc_year);
+    break;
+  default:
+    for (size_t i = 0; i < n; ++i) {
+      result[i] = abs_day[i];
+    }
+  }
+}
+
+/*
+ * Splits each block into absolute days, truncates the days in one batch, then
+ * scales the bucket days back to nanoseconds.
+ */
+void leap_trunc_time_ns_n(const int64_t *ns, size_t n, int epoch, enum leap_unit unit, int64_t *result) {
+  int day[LEAP_TRUNC_BLOCK];
+  for (size_t i = 0; i < n; i += LEAP_TRUNC_BLOCK) {
+    const size_t m = n - i < LEAP_TRUNC_BLOCK ? n - i : LEAP_TRUNC_BLOCK;
+    for (size_t j = 0; j < m; ++j) {
+      day[j] = epoch + (int)LEAP_DIV64_QUO_MOD(ns[i + j], 86400000000000).quo;
+    }
+    leap_trunc_n(day, m, unit, day);
+    for (size_t j = 0; j < m; ++j) {
+      result[i + j] = (int64_t)((uint64_t)(day[j] - epoch) * UINT64_C(86400000000000));
+    }
+  }
+}
@@ -0,0 +1,38 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_wday.c
+ * \brief Leap weekday function implementations.
+ * \details Implements the weekday functions declared in the \c leap_wday.h
+ * header file.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#include "leap_wday.h"
+#include "leap_div.h"
+
+/*
+ * Floored modulus by seven. Inlines into the batch loop so that the compiler
+ * sees the whole multiply, shift and subtract and can vectorise it.
+ */
+static inline int leap_wday_mod7(int x) { return LEAP_DIV_QUO_MOD(x, 7).mod; }
+
+int leap_wday(int abs_day) { return leap_wday_mod7(abs_day + LEAP_WDAY0); }
+
+int leap_wday_from(int year, int month, int day) {
+  /*
+   * Weekday offsets for the first of each month, counting January and
+   * February as the tail of the previous year so that its leap day, if any,
+   * falls after them (Sakamoto, 1993).
+   */
+  static const int WDAY[] = {0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4};
+  const struct quo_mod mon = LEAP_DIV_QUO_MOD(month - 1, 12);
+  const int y = year + mon.quo - (mon.mod < 2);
+  const int thru = LEAP_DIV_QUO_MOD(y, 4).quo - LEAP_DIV_QUO_MOD(y, 100).quo + LEAP_DIV_QUO_MOD(y, 400).quo;
+  return leap_wday_mod7(y + thru + WDAY[mon.mod] + day);
+}
+
+void leap_wday_n(const int *abs_day, size_t n, int *wday) {
+  for (size_t i = 0; i < n; ++i) {
+    wday[i] = leap_wday_mod7(abs_day[i] + LEAP_WDAY0);
+  }
+}
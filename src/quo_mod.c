@@ -8,8 +8,53 @@
  */
 
 #include "quo_mod.h"
+#include "leap_stats.h"
+
+#ifdef LEAPC_NO_DIVIDE
+
+/*
+ * Divides without dividing. Restoring binary long division over the operands'
+ * magnitudes brings down one numerator bit per step, subtracting the
+ * denominator by mask whenever the partial remainder reaches it. Always 32
+ * steps whatever the operands.
+ */
+struct quo_mod quo_mod(int x, int y) {
+  LEAP_STATS_INC(quo_mod);
+  const unsigned sx = (unsigned)(x >> 31);
+  const unsigned sy = (unsigned)(y >> 31);
+  const unsigned n = ((unsigned)x ^ sx) - sx;
+  const unsigned d = ((unsigned)y ^ sy) - sy;
+  unsigned q = 0U;
+  unsigned r = 0U;
+  for (int i = 31; i >= 0; --i) {
+    r = r << 1 | (n >> i & 1U);
+    const unsigned ge = r >= d;
+    r -= d & -ge;
+    q |= ge << i;
+  }
+
+  /*
+   * Apply the signs to give C's truncated quotient and remainder: the quotient
+   * negates when the signs differ, the remainder takes the numerator's sign.
+   */
+  int quo = (int)((q ^ (sx ^ sy)) - (sx ^ sy));
+  int mod = (int)((r ^ sx) - sx);
+
+  /*
+   * Adjust as below. The mask is all ones when the adjustment applies, all
+   * zeros otherwise. Adding the denominator to the modulus takes one from the
+   * quotient.
+   */
+  const int adjust = -((mod != 0) & ((mod ^ y) < 0));
+  mod += y & adjust;
+  quo += adjust;
+  return (struct quo_mod){.quo = quo, .mod = mod};
+}
+
+#else
 
 struct quo_mod quo_mod(int x, int y) {
+  LEAP_STATS_INC(quo_mod);
   /*
    * Compute modulus using C's % operator. Note that C's % operator will yield
    * negative results when the numerator is negative.
@@ -23,12 +68,22 @@ struct quo_mod quo_mod(int x, int y) {
    *
    * This matches Lua's modulo operator behaviour.
    */
+#ifdef LEAPC_WCET
+  /*
+   * Mask rather than branch. The mask is all ones when the adjustment applies,
+   * all zeros otherwise.
+   */
+  mod += y & -((mod != 0) & ((mod ^ y) < 0));
+#else
   if (mod != 0 && (mod ^ y) < 0) {
     mod += y;
   }
+#endif
 
   /*
    * Returns a quo_mod structure by casting an initialiser. Is this portable?
    */
   return (struct quo_mod){.quo = (x - mod) / y, .mod = mod};
 }
+
+#endif /* LEAPC_NO_DIVIDE */
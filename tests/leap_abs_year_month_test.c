@@ -0,0 +1,27 @@
+#include "leap.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+int leap_abs_year_month_test(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  assert(equal_leap_year_month((struct leap_year_month){0, 1}, leap_abs_year_month(0)));
+  assert(equal_leap_year_month((struct leap_year_month){-1, 12}, leap_abs_year_month(-1)));
+  assert(equal_leap_year_month((struct leap_year_month){1970, 1}, leap_abs_year_month(LEAP_MCMLXX)));
+  assert(equal_leap_year_month((struct leap_year_month){2024, 2}, leap_abs_year_month(leap_abs_from(2024, 2, 29))));
+  assert(equal_leap_year_month((struct leap_year_month){2024, 3}, leap_abs_year_month(leap_abs_from(2024, 3, 1))));
+  assert(equal_leap_year_month((struct leap_year_month){LEAP_YEAR_MIN, 1}, leap_abs_year_month(LEAP_ABS_MIN)));
+  assert(equal_leap_year_month((struct leap_year_month){LEAP_YEAR_MAX, 12}, leap_abs_year_month(LEAP_ABS_MAX)));
+
+  /*
+   * Agrees with the full decoder.
+   */
+  for (int day_off = -1000000; day_off <= 1000000; day_off += 7) {
+    const struct leap_date date = leap_abs_date(day_off);
+    assert(equal_leap_year_month((struct leap_year_month){date.year, date.month}, leap_abs_year_month(day_off)));
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,35 @@
+#include "leap.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+int leap_abs_year_test(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  assert(0 == leap_abs_year(0));
+  assert(0 == leap_abs_year(365));
+  assert(1 == leap_abs_year(366));
+  assert(-1 == leap_abs_year(-1));
+  assert(1970 == leap_abs_year(LEAP_MCMLXX));
+  assert(1969 == leap_abs_year(LEAP_MCMLXX - 1));
+  assert(LEAP_YEAR_MIN == leap_abs_year(LEAP_ABS_MIN));
+  assert(LEAP_YEAR_MAX == leap_abs_year(LEAP_ABS_MAX));
+
+  /*
+   * Agrees with the full decoder either side of every January and March.
+   */
+  for (int year = -801; year <= 2401; ++year) {
+    const int jan1 = leap_abs_from(year, 1, 1);
+    const int mar1 = leap_abs_from(year, 3, 1);
+    assert(year == leap_abs_year(jan1));
+    assert(year - 1 == leap_abs_year(jan1 - 1));
+    assert(year == leap_abs_year(mar1));
+    assert(year == leap_abs_year(mar1 - 1));
+  }
+  for (int day_off = -1000000; day_off <= 1000000; day_off += 97) {
+    assert(leap_abs_date(day_off).year == leap_abs_year(day_off));
+  }
+
+  return EXIT_SUCCESS;
+}
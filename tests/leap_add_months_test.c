@@ -0,0 +1,86 @@
+#include "leap.h"
+#include "leap_month.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+#define N 1000
+
+int leap_add_months_test(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  /*
+   * 31 January plus one month, by policy, in a common year and a leap year.
+   */
+  assert(equal_leap_date((struct leap_date){2023, 2, 28},
+                         leap_add_months((struct leap_date){2023, 1, 31}, 1, LEAP_EOM_CLAMP)));
+  assert(equal_leap_date((struct leap_date){2024, 2, 29},
+                         leap_add_months((struct leap_date){2024, 1, 31}, 1, LEAP_EOM_CLAMP)));
+  assert(equal_leap_date((struct leap_date){2023, 3, 3},
+                         leap_add_months((struct leap_date){2023, 1, 31}, 1, LEAP_EOM_OVERFLOW)));
+  assert(equal_leap_date((struct leap_date){2024, 3, 2},
+                         leap_add_months((struct leap_date){2024, 1, 31}, 1, LEAP_EOM_OVERFLOW)));
+  assert(equal_leap_date((struct leap_date){2023, 2, 28},
+                         leap_add_months((struct leap_date){2023, 1, 31}, 1, LEAP_EOM_STICK)));
+
+  /*
+   * Sticking to the end of February lands on the end of March; clamping lands
+   * on the 28th.
+   */
+  assert(equal_leap_date((struct leap_date){2023, 3, 31},
+                         leap_add_months((struct leap_date){2023, 2, 28}, 1, LEAP_EOM_STICK)));
+  assert(equal_leap_date((struct leap_date){2023, 3, 28},
+                         leap_add_months((struct leap_date){2023, 2, 28}, 1, LEAP_EOM_CLAMP)));
+  assert(equal_leap_date((struct leap_date){2024, 3, 28},
+                         leap_add_months((struct leap_date){2024, 2, 28}, 1, LEAP_EOM_STICK)));
+
+  /*
+   * Months carry into years both ways.
+   */
+  assert(equal_leap_date((struct leap_date){2025, 1, 15},
+                         leap_add_months((struct leap_date){2024, 12, 15}, 1, LEAP_EOM_CLAMP)));
+  assert(equal_leap_date((struct leap_date){2023, 11, 30},
+                         leap_add_months((struct leap_date){2024, 1, 31}, -2, LEAP_EOM_CLAMP)));
+  assert(equal_leap_date((struct leap_date){-1, 12, 31},
+                         leap_add_months((struct leap_date){0, 12, 31}, -12, LEAP_EOM_CLAMP)));
+  assert(equal_leap_date((struct leap_date){2124, 5, 31},
+                         leap_add_months((struct leap_date){2024, 4, 30}, 1201, LEAP_EOM_STICK)));
+
+  /*
+   * Only 29 February needs a policy when adding years.
+   */
+  assert(equal_leap_date((struct leap_date){2025, 2, 28},
+                         leap_add_years((struct leap_date){2024, 2, 29}, 1, LEAP_EOM_CLAMP)));
+  assert(equal_leap_date((struct leap_date){2025, 3, 1},
+                         leap_add_years((struct leap_date){2024, 2, 29}, 1, LEAP_EOM_OVERFLOW)));
+  assert(equal_leap_date((struct leap_date){2028, 2, 29},
+                         leap_add_years((struct leap_date){2024, 2, 29}, 4, LEAP_EOM_OVERFLOW)));
+  assert(equal_leap_date((struct leap_date){2024, 2, 29},
+                         leap_add_years((struct leap_date){2023, 2, 28}, 1, LEAP_EOM_STICK)));
+  assert(equal_leap_date((struct leap_date){2024, 2, 28},
+                         leap_add_years((struct leap_date){2023, 2, 28}, 1, LEAP_EOM_CLAMP)));
+
+  /*
+   * Batches agree with single dates under every policy.
+   */
+  static int abs_day[N], result[N];
+  for (int i = 0; i < N; ++i) {
+    abs_day[i] = leap_abs_from(1900, 1, 1) + i * 73;
+  }
+  abs_day[0] = LEAP_ABS_MIN;
+  abs_day[1] = LEAP_ABS_MAX - 366;
+  const enum leap_eom eoms[] = {LEAP_EOM_CLAMP, LEAP_EOM_OVERFLOW, LEAP_EOM_STICK};
+  for (int e = 0; e < 3; ++e) {
+    for (int months = -25; months <= 25; months += 5) {
+      leap_add_months_n(abs_day, N, months, eoms[e], result);
+      for (int i = 0; i < N; ++i) {
+        const struct leap_date date = leap_add_months(leap_abs_date(abs_day[i]), months, eoms[e]);
+        assert(leap_abs_from_date(date) == result[i]);
+        assert(1 <= date.day && date.day <= leap_mday(date.year, date.month));
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
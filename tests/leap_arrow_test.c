@@ -0,0 +1,135 @@
+#include "leap.h"
+#include "leap_arrow.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define N 1000
+
+/*
+ * Wraps caller buffers in an input array with one validity and one data
+ * buffer. The test owns the buffers, so the array needs no release.
+ */
+static struct ArrowArray input(const void **buffers, int64_t length, int64_t null_count, int64_t offset) {
+  return (struct ArrowArray){
+      .length = length,
+      .null_count = null_count,
+      .offset = offset,
+      .n_buffers = 2,
+      .buffers = buffers,
+  };
+}
+
+static const int32_t *child(const struct ArrowArray *array, int k) { return array->children[k]->buffers[1]; }
+
+int leap_arrow_test(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  /*
+   * Date32 days since 1970, one slot skipped by the offset and one null.
+   */
+  static int32_t date32[N + 1];
+  static uint8_t bits[(N + 1 + 7) / 8];
+  memset(bits, 0xff, sizeof(bits));
+  bits[0] &= (uint8_t)~(1 << 3);
+  for (int i = 0; i <= N; ++i) {
+    date32[i] = rand() % 200000 - 100000;
+  }
+  date32[1] = leap_abs_from(2024, 2, 29) - LEAP_MCMLXX;
+  const void *buffers[] = {bits, date32};
+  struct ArrowArray array = input(buffers, N, 1, 1);
+  struct ArrowSchema schema = {.format = "tdD"};
+  struct ArrowSchema fields_schema;
+  struct ArrowArray fields;
+  assert(0 == leap_arrow_fields(&schema, &array, &fields_schema, &fields));
+  assert(0 == strcmp("+s", fields_schema.format) && 4 == fields_schema.n_children);
+  assert(0 == strcmp("weekday", fields_schema.children[3]->name));
+  assert(N == fields.length && 4 == fields.n_children && 1 == fields.children[0]->null_count);
+  assert(2024 == child(&fields, 0)[0] && 2 == child(&fields, 1)[0] && 29 == child(&fields, 2)[0]);
+  assert(4 == child(&fields, 3)[0]);
+  assert(0 == child(&fields, 0)[2]);
+  const uint8_t *valid = fields.children[0]->buffers[0];
+  assert(0 == (valid[0] >> 2 & 1) && 1 == (valid[0] & 1));
+  for (int i = 0; i < N; ++i) {
+    if (i == 2) {
+      continue;
+    }
+    const struct leap_date date = leap_abs_date(LEAP_MCMLXX + date32[i + 1]);
+    assert(date.year == child(&fields, 0)[i] && date.month == child(&fields, 1)[i] && date.day == child(&fields, 2)[i]);
+  }
+
+  /*
+   * The fields convert back, in both date widths, nulls included.
+   */
+  struct ArrowSchema dates_schema;
+  struct ArrowArray dates;
+  assert(0 == leap_arrow_dates(&fields_schema, &fields, "tdD", &dates_schema, &dates));
+  assert(0 == strcmp("tdD", dates_schema.format) && 1 == dates.null_count);
+  for (int i = 0; i < N; ++i) {
+    assert(i == 2 || date32[i + 1] == ((const int32_t *)dates.buffers[1])[i]);
+  }
+  dates.release(&dates);
+  dates_schema.release(&dates_schema);
+  assert(dates.release == NULL && dates_schema.release == NULL);
+  assert(0 == leap_arrow_dates(&fields_schema, &fields, "tdm", &dates_schema, &dates));
+  assert(INT64_C(86400000) * date32[N] == ((const int64_t *)dates.buffers[1])[N - 1]);
+  dates.release(&dates);
+  dates_schema.release(&dates_schema);
+  assert(EINVAL == leap_arrow_dates(&fields_schema, &fields, "tsn:", &dates_schema, &dates));
+  assert(EINVAL == leap_arrow_dates(&schema, &array, "tdD", &dates_schema, &dates));
+  fields.release(&fields);
+  fields_schema.release(&fields_schema);
+  assert(fields.release == NULL && fields_schema.release == NULL);
+
+  /*
+   * Timestamps floor to days; the time zone makes no difference.
+   */
+  int64_t ns[] = {INT64_C(951782400000000000), -1, INT64_MAX, INT64_MIN};
+  const void *ns_buffers[] = {NULL, ns};
+  array = input(ns_buffers, 4, 0, 0);
+  schema.format = "tsn:Europe/London";
+  assert(0 == leap_arrow_fields(&schema, &array, &fields_schema, &fields));
+  assert(NULL == fields.children[0]->buffers[0] && 0 == fields.children[0]->null_count);
+  assert(2000 == child(&fields, 0)[0] && 2 == child(&fields, 1)[0] && 29 == child(&fields, 2)[0]);
+  assert(1969 == child(&fields, 0)[1] && 12 == child(&fields, 1)[1] && 31 == child(&fields, 2)[1]);
+  assert(2262 == child(&fields, 0)[2] && 1677 == child(&fields, 0)[3]);
+  assert(0 == ((uintptr_t)fields.children[3]->buffers[1] & 63));
+
+  /*
+   * A child moved out survives the release of its parent.
+   */
+  struct ArrowArray year = *fields.children[0];
+  struct ArrowSchema year_schema = *fields_schema.children[0];
+  fields.children[0]->release = NULL;
+  fields_schema.children[0]->release = NULL;
+  fields.release(&fields);
+  fields_schema.release(&fields_schema);
+  assert(2000 == ((const int32_t *)year.buffers[1])[0] && 0 == strcmp("year", year_schema.name));
+  year.release(&year);
+  year_schema.release(&year_schema);
+  assert(year.release == NULL && year_schema.release == NULL);
+
+  /*
+   * Date64 days beyond the safe range overflow unless null.
+   */
+  int64_t ms[] = {INT64_MAX};
+  uint8_t none[] = {0};
+  const void *ms_buffers[] = {NULL, ms};
+  array = input(ms_buffers, 1, 0, 0);
+  schema.format = "tdm";
+  assert(EOVERFLOW == leap_arrow_fields(&schema, &array, &fields_schema, &fields));
+  ms_buffers[0] = none;
+  array = input(ms_buffers, 1, 1, 0);
+  assert(0 == leap_arrow_fields(&schema, &array, &fields_schema, &fields));
+  fields.release(&fields);
+  fields_schema.release(&fields_schema);
+  schema.format = "tsx:";
+  assert(EINVAL == leap_arrow_fields(&schema, &array, &fields_schema, &fields));
+  schema.format = "i";
+  assert(EINVAL == leap_arrow_fields(&schema, &array, &fields_schema, &fields));
+
+  return EXIT_SUCCESS;
+}
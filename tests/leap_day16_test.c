@@ -0,0 +1,42 @@
+#include "leap.h"
+#include "leap_day16.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+int leap_day16_test(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  assert(leap_day(LEAPC_DAY16_EPOCH) == LEAP_DAY16_EPOCH);
+  assert(leap_day(1) == LEAP_DAY16_DAY(1) && leap_day(2000) == LEAP_DAY16_DAY(2000));
+  assert(leap_day(2100) == LEAP_DAY16_DAY(2100) && leap_day(2401) == LEAP_DAY16_DAY(2401));
+
+  uint16_t day16 = 1;
+  assert(leap_day16_encode(LEAP_DAY16_EPOCH, &day16) && 0 == day16);
+  assert(leap_day16_encode(LEAP_DAY16_EPOCH + UINT16_MAX, &day16) && UINT16_MAX == day16);
+  assert(!leap_day16_encode(LEAP_DAY16_EPOCH - 1, &day16));
+  assert(!leap_day16_encode(LEAP_DAY16_EPOCH + UINT16_MAX + 1, &day16));
+  assert(!leap_day16_encode(LEAP_ABS_MIN, &day16));
+  assert(!leap_day16_encode(LEAP_ABS_MAX, &day16));
+  assert(UINT16_MAX == day16);
+
+  const struct leap_date last = leap_abs_date(LEAP_DAY16_EPOCH + UINT16_MAX);
+  const struct leap_date next = leap_abs_date(LEAP_DAY16_EPOCH + UINT16_MAX + 1);
+  assert(!leap_day16_from_date((struct leap_date){LEAPC_DAY16_EPOCH - 1, 12, 31}, &day16));
+  assert(!leap_day16_from_date(next, &day16));
+  assert(!leap_day16_from_date((struct leap_date){LEAPC_DAY16_EPOCH + LEAP_DAY16_YEARS, 1, 1}, &day16));
+  assert(leap_day16_from_date(last, &day16) && UINT16_MAX == day16);
+
+  /*
+   * Every offset in the window decodes as leap_abs_date() does and encodes
+   * back from its date.
+   */
+  for (int i = 0; i <= UINT16_MAX; ++i) {
+    const struct leap_date date = leap_day16_date((uint16_t)i);
+    assert(equal_leap_date(leap_abs_date(leap_day16_abs((uint16_t)i)), date));
+    assert(leap_day16_from_date(date, &day16) && i == day16);
+  }
+
+  return EXIT_SUCCESS;
+}
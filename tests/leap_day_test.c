@@ -7,6 +7,9 @@ int leap_day_test(int argc, char **argv) {
   assert(366 == leap_day(1));
   assert(693961 == leap_day(1900));
   assert(25567 == leap_day(1970) - leap_day(1900));
+  assert(LEAP_MCMLXX == leap_day(1970));
+  assert(LEAP_ABS_MIN == leap_day(LEAP_YEAR_MIN));
+  assert(LEAP_ABS_MAX == leap_day(LEAP_YEAR_MAX + 1) - 1);
 
   for (int year0 = 1970; year0 < 2025; year0++)
     for (int year_span = 1; year_span < 50; year_span++) {
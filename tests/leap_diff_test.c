@@ -0,0 +1,66 @@
+#include "leap.h"
+#include "leap_month.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+#define N 1000
+
+int leap_diff_test(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  const struct leap_date born = {2024, 2, 29};
+  assert(equal_leap_diff((struct leap_diff){1, 0, 0},
+                         leap_diff(born, (struct leap_date){2025, 2, 28}, LEAP_EOM_CLAMP)));
+  assert(equal_leap_diff((struct leap_diff){0, 11, 30},
+                         leap_diff(born, (struct leap_date){2025, 2, 28}, LEAP_EOM_OVERFLOW)));
+  assert(equal_leap_diff((struct leap_diff){1, 0, 0},
+                         leap_diff(born, (struct leap_date){2025, 3, 1}, LEAP_EOM_OVERFLOW)));
+  assert(equal_leap_diff((struct leap_diff){4, 0, 0},
+                         leap_diff(born, (struct leap_date){2028, 2, 29}, LEAP_EOM_STICK)));
+  assert(equal_leap_diff((struct leap_diff){-1, 0, 0},
+                         leap_diff((struct leap_date){2025, 2, 28}, born, LEAP_EOM_CLAMP)));
+
+  /*
+   * 31 January to 2 March 2023: one month clamps to 28 February leaving two
+   * days, whereas overflowing lands on 3 March, past the later date.
+   */
+  const struct leap_date jan31 = {2023, 1, 31}, mar2 = {2023, 3, 2};
+  assert(equal_leap_diff((struct leap_diff){0, 1, 2}, leap_diff(jan31, mar2, LEAP_EOM_CLAMP)));
+  assert(equal_leap_diff((struct leap_diff){0, 0, 30}, leap_diff(jan31, mar2, LEAP_EOM_OVERFLOW)));
+  assert(1 == leap_months_between(jan31, mar2, LEAP_EOM_CLAMP));
+  assert(-1 == leap_months_between(mar2, jan31, LEAP_EOM_CLAMP));
+  assert(0 == leap_months_between(jan31, jan31, LEAP_EOM_STICK));
+  assert(equal_leap_diff((struct leap_diff){-2000, -11, -30},
+                         leap_diff((struct leap_date){2000, 1, 1}, (struct leap_date){-1, 1, 2}, LEAP_EOM_CLAMP)));
+
+  /*
+   * Adding the difference back lands on the later date, and batches agree.
+   */
+  static int from[N], to[N], years[N], months[N], days[N], between[N];
+  for (int i = 0; i < N; ++i) {
+    from[i] = leap_abs_from(1999, 12, 31) + (i * 7919) % 4000;
+    to[i] = leap_abs_from(1999, 12, 1) + (i * 104729) % 9000;
+  }
+  const enum leap_eom eoms[] = {LEAP_EOM_CLAMP, LEAP_EOM_OVERFLOW, LEAP_EOM_STICK};
+  for (int e = 0; e < 3; ++e) {
+    leap_diff_n(from, to, N, eoms[e], &(struct leap_diff_cols){years, months, days});
+    leap_months_between_n(from, to, N, eoms[e], between);
+    for (int i = 0; i < N; ++i) {
+      const struct leap_date a = leap_abs_date(from[i]), b = leap_abs_date(to[i]);
+      const struct leap_diff diff = leap_diff(a, b, eoms[e]);
+      assert(equal_leap_diff(diff, (struct leap_diff){years[i], months[i], days[i]}));
+      assert(diff.years * 12 + diff.months == between[i]);
+      assert(between[i] == leap_months_between(a, b, eoms[e]));
+      const int sign = from[i] <= to[i] ? 1 : -1;
+      const struct leap_date lo = sign > 0 ? a : b;
+      const int hi = sign > 0 ? to[i] : from[i];
+      assert(hi == leap_abs_from_date(leap_add_months(lo, sign * between[i], eoms[e])) + sign * days[i]);
+      assert(hi < leap_abs_from_date(leap_add_months(lo, sign * between[i] + 1, eoms[e])));
+      assert(0 <= sign * months[i] && sign * months[i] < 12 && 0 <= sign * days[i]);
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
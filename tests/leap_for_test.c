@@ -0,0 +1,101 @@
+#include "leap.h"
+#include "leap_for.h"
+
+#include <assert.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define N 1000
+
+/*
+ * Naive month runs for comparison.
+ */
+static size_t runs(const int *abs_day, size_t n, struct leap_year_month *month, size_t *count) {
+  size_t m = 0;
+  for (size_t i = 0; i < n; ++i) {
+    const struct leap_year_month ym = leap_abs_year_month(abs_day[i]);
+    if (m > 0 && equal_leap_year_month(ym, month[m - 1])) {
+      ++count[m - 1];
+    } else {
+      month[m] = ym;
+      count[m++] = 1;
+    }
+  }
+  return m;
+}
+
+static void round_trip(const int *abs_day, size_t n) {
+  static uint32_t packed[LEAP_FOR_WORDS(N)];
+  static int day[N];
+  static struct leap_date date[N];
+  static struct leap_year_month want_month[N], got_month[N];
+  static size_t want_count[N], got_count[N];
+  const size_t words = leap_for_encode(abs_day, n, packed);
+  assert(words <= LEAP_FOR_WORDS(n));
+  assert(n == leap_for_count(packed));
+  leap_for_decode(packed, day);
+  assert(0 == memcmp(abs_day, day, n * sizeof(*day)));
+  leap_for_decode_date(packed, date);
+  for (size_t i = 0; i < n; ++i) {
+    assert(equal_leap_date(leap_abs_date(abs_day[i]), date[i]));
+  }
+  const size_t want = runs(abs_day, n, want_month, want_count);
+  assert(want == leap_for_month_runs(packed, got_month, got_count, N));
+  for (size_t i = 0; i < want; ++i) {
+    assert(equal_leap_year_month(want_month[i], got_month[i]) && want_count[i] == got_count[i]);
+  }
+  if (want > 1) {
+    assert(want == leap_for_month_runs(packed, got_month, got_count, 1));
+    assert(want_count[0] == got_count[0]);
+  }
+}
+
+int leap_for_test(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  static int abs_day[N];
+  uint32_t packed[LEAP_FOR_WORDS(N)];
+
+  /*
+   * A sorted partition a few thousand days wide packs into a few bits a day.
+   */
+  abs_day[0] = leap_abs_from(2024, 1, 1);
+  for (int i = 1; i < N; ++i) {
+    abs_day[i] = abs_day[i - 1] + rand() % 4;
+  }
+  assert(leap_for_encode(abs_day, N, packed) < N / 4);
+  round_trip(abs_day, N);
+  round_trip(abs_day, 1);
+  round_trip(abs_day, 200);
+  round_trip(abs_day, 0);
+
+  /*
+   * The same day throughout packs no bits.
+   */
+  for (int i = 0; i < N; ++i) {
+    abs_day[i] = LEAP_MCMLXX;
+  }
+  assert(1 + 8 * 3 == leap_for_encode(abs_day, N, packed));
+  round_trip(abs_day, N);
+
+  /*
+   * Unsorted and widely spread days still round trip.
+   */
+  for (int i = 0; i < N; ++i) {
+    abs_day[i] = rand() % 2000000 - 1000000;
+  }
+  round_trip(abs_day, N);
+  abs_day[0] = LEAP_ABS_MIN;
+  abs_day[1] = LEAP_ABS_MAX;
+  abs_day[2] = LEAP_ABS_MIN;
+  round_trip(abs_day, N);
+  int extremes[] = {INT_MIN, INT_MAX, 0, -1};
+  leap_for_encode(extremes, 4, packed);
+  int day[4];
+  leap_for_decode(packed, day);
+  assert(0 == memcmp(extremes, day, sizeof(day)));
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,99 @@
+#define _DEFAULT_SOURCE
+
+#include "leap.h"
+#include "leap_format.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define N 100000
+
+int leap_format_compiled_test(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  struct leap_format http, path, all, log;
+  assert(leap_format_compile(&http, "%a, %d %b %Y %H:%M:%S GMT"));
+  assert(leap_format_compile(&path, "%Y/%m/%d"));
+  assert(leap_format_compile(&all, "%A %B %e %y %j %h%%"));
+  assert(leap_format_compile(&log, "%H:%M:%S %Y-%m-%d"));
+
+  char out[LEAP_FORMAT_MAX + 1];
+  assert(10 == leap_format_compiled(&path, LEAP_MCMLXX, out, sizeof(out)));
+  assert(0 == strcmp("1970/01/01", out));
+  assert(32 == leap_format_compiled(&all, leap_day(2024) + 59, out, sizeof(out)));
+  assert(0 == strcmp("Thursday February 29 24 060 Feb%", out));
+  assert(0 == leap_format_compiled(&path, LEAP_MCMLXX, out, 10));
+  assert(10 == leap_format_compiled(&path, LEAP_MCMLXX, out, 11));
+  assert(10 == leap_format_compiled(&path, 0, out, sizeof(out)));
+  assert(0 == strcmp("0000/01/01", out));
+  assert(10 == leap_format_compiled(&path, LEAP_FORMAT_ABS_MAX, out, sizeof(out)));
+  assert(0 == strcmp("9999/12/31", out));
+  assert(0 == leap_format_compiled(&path, -1, out, sizeof(out)));
+  assert(0 == leap_format_compiled(&path, LEAP_FORMAT_ABS_MAX + 1, out, sizeof(out)));
+
+  /*
+   * The cache re-renders its prefix only when the day changes. Time-of-day
+   * conversions before any date conversion leave nothing to cache.
+   */
+  struct leap_format_cache cache;
+  leap_format_cache_init(&cache, &http);
+  assert(9 == cache.split);
+  assert(29 == leap_format_cached(&cache, 784111777, LEAP_MCMLXX, out, sizeof(out)));
+  assert(0 == strcmp("Sun, 06 Nov 1994 08:49:37 GMT", out));
+  assert(17 == cache.len && 0 == memcmp("Sun, 06 Nov 1994 ", cache.prefix, 17));
+  assert(29 == leap_format_cached(&cache, 784111777 + 3600, LEAP_MCMLXX, out, sizeof(out)));
+  assert(0 == strcmp("Sun, 06 Nov 1994 09:49:37 GMT", out));
+  assert(0 == leap_format_cached(&cache, 0, LEAP_MCMLXX, out, 29));
+  assert(29 == leap_format_cached(&cache, -1, LEAP_MCMLXX, out, 30));
+  assert(0 == strcmp("Wed, 31 Dec 1969 23:59:59 GMT", out));
+  const int64_t last = (int64_t)(LEAP_FORMAT_ABS_MAX + 1 - LEAP_MCMLXX) * 86400 - 1;
+  assert(29 == leap_format_cached(&cache, last, LEAP_MCMLXX, out, sizeof(out)));
+  assert(0 == strcmp("Fri, 31 Dec 9999 23:59:59 GMT", out));
+  assert(0 == leap_format_cached(&cache, last + 1, LEAP_MCMLXX, out, sizeof(out)));
+  assert(0 == leap_format_cached(&cache, INT64_MAX, LEAP_MCMLXX, out, sizeof(out)));
+  assert(0 == leap_format_cached(&cache, INT64_MIN, LEAP_MCMLXX, out, sizeof(out)));
+  leap_format_cache_init(&cache, &log);
+  assert(0 == cache.split);
+  assert(19 == leap_format_cached(&cache, 951782400, LEAP_MCMLXX, out, sizeof(out)));
+  assert(0 == strcmp("00:00:00 2000-02-29", out));
+
+  /*
+   * The new conversions parse too, checking form and range only.
+   */
+  struct leap_date date;
+  const char *text = "Sun, 06 Nov 1994 08:49:37 GMT";
+  assert(leap_parse_compiled(&http, text, strlen(text), &date));
+  assert(equal_leap_date((struct leap_date){1994, 11, 6}, date));
+  text = "Sun, 06 Nov 1994 24:49:37 GMT";
+  assert(!leap_parse_compiled(&http, text, strlen(text), &date));
+  text = "Any, 06 Nov 1994 08:49:37 GMT";
+  assert(!leap_parse_compiled(&http, text, strlen(text), &date));
+
+#if defined(__unix__) || defined(__APPLE__)
+  /*
+   * Cached output agrees with gmtime and strftime in the C locale across a
+   * sorted stream of random timestamps.
+   */
+  leap_format_cache_init(&cache, &http);
+  int64_t sec = -2208988800;
+  for (int i = 0; i < N; ++i) {
+    sec += rand() % 20000;
+    const time_t t = (time_t)sec;
+    struct tm tm;
+    char want[64];
+    assert(gmtime_r(&t, &tm) != NULL);
+    assert(strftime(want, sizeof(want), "%a, %d %b %Y %H:%M:%S GMT", &tm) != 0);
+    assert(strlen(want) == leap_format_cached(&cache, sec, LEAP_MCMLXX, out, sizeof(out)));
+    if (strcmp(want, out) != 0) {
+      fprintf(stderr, "%lld: want %s got %s\n", (long long)sec, want, out);
+      return EXIT_FAILURE;
+    }
+  }
+#endif
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,91 @@
+#include "leap.h"
+#include "leap_format.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define N 1000
+
+int leap_format_iso_test(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  char out[LEAP_FORMAT_ISO_TIME_NS + 1] = {0};
+  leap_format_iso(leap_abs_from(2024, 2, 29), out);
+  assert(0 == strcmp("2024-02-29", out));
+  leap_format_iso(0, out);
+  assert(0 == strcmp("0000-01-01", out));
+  leap_format_iso(leap_abs_from(9999, 12, 31), out);
+  assert(0 == strcmp("9999-12-31", out));
+
+  leap_format_iso_time(-1, LEAP_MCMLXX, out);
+  assert(0 == strcmp("1969-12-31T23:59:59Z", out));
+  leap_format_iso_time_ns(-1, LEAP_MCMLXX, out);
+  assert(0 == strcmp("1969-12-31T23:59:59.999999999Z", out));
+  leap_format_iso_time_ns(INT64_MAX, LEAP_MCMLXX, out);
+  assert(0 == strcmp("2262-04-11T23:47:16.854775807Z", out));
+  leap_format_iso_time_ns(INT64_MIN, LEAP_MCMLXX, out);
+  assert(0 == strcmp("1677-09-21T00:12:43.145224192Z", out));
+  leap_format_iso_time_ns(1000000007, LEAP_MCMLXX, out);
+  assert(0 == strcmp("1970-01-01T00:00:01.000000007Z", out));
+
+  /*
+   * Days and times beyond four-digit years saturate.
+   */
+  memset(out, 0, sizeof(out));
+  leap_format_iso(-1, out);
+  assert(0 == strcmp("0000-01-01", out));
+  leap_format_iso(LEAP_ABS_MAX, out);
+  assert(0 == strcmp("9999-12-31", out));
+  memset(out, 0, sizeof(out));
+  leap_format_iso_time(INT64_MAX, LEAP_MCMLXX, out);
+  assert(0 == strcmp("9999-12-31T23:59:59Z", out));
+  leap_format_iso_time(INT64_MIN, LEAP_MCMLXX, out);
+  assert(0 == strcmp("0000-01-01T00:00:00Z", out));
+  leap_format_iso_time(-86400, 0, out);
+  assert(0 == strcmp("0000-01-01T00:00:00Z", out));
+  leap_format_iso_time(-1, LEAP_FORMAT_ABS_MAX + 1, out);
+  assert(0 == strcmp("9999-12-31T23:59:59Z", out));
+  leap_format_iso_time_ns(0, LEAP_FORMAT_ABS_MAX + 1, out);
+  assert(0 == strcmp("9999-12-31T23:59:59.999999999Z", out));
+  leap_format_iso_time_ns(-1, 0, out);
+  assert(0 == strcmp("0000-01-01T00:00:00.000000000Z", out));
+
+  /*
+   * Batches write at a fixed stride, leaving delimiters alone, and agree with
+   * printf.
+   */
+  static int abs_day[N];
+  static int64_t ns[N];
+  static char buf[N * 32];
+  for (int i = 0; i < N; ++i) {
+    abs_day[i] = i * 3652 + 17;
+    ns[i] = (int64_t)(i - N / 2) * INT64_C(18446744073709551) + i * 7;
+  }
+  memset(buf, '\n', sizeof(buf));
+  assert(0 == leap_format_iso_n(abs_day, N, buf, 11));
+  for (int i = 0; i < N; ++i) {
+    const struct leap_date date = leap_abs_date(abs_day[i]);
+    char want[16];
+    (void)snprintf(want, sizeof(want), "%04d-%02d-%02d\n", date.year, date.month, date.day);
+    assert(0 == memcmp(want, buf + i * 11, 11));
+  }
+  memset(buf, ',', sizeof(buf));
+  assert(0 == leap_format_iso_time_ns_n(ns, N, LEAP_MCMLXX, buf, 31));
+  for (int i = 0; i < N; ++i) {
+    leap_format_iso_time_ns(ns[i], LEAP_MCMLXX, out);
+    assert(0 == memcmp(out, buf + i * 31, 30));
+    assert(',' == buf[i * 31 + 30]);
+  }
+  const int edge[] = {-1, 0, LEAP_FORMAT_ABS_MAX, LEAP_FORMAT_ABS_MAX + 1};
+  assert(2 == leap_format_iso_n(edge, 4, buf, 10));
+  assert(0 == memcmp("0000-01-010000-01-019999-12-319999-12-31", buf, 40));
+  const int64_t edge_ns[] = {-1, 0};
+  assert(1 == leap_format_iso_time_ns_n(edge_ns, 2, 0, buf, 30));
+  assert(0 == memcmp("0000-01-01T00:00:00.000000000Z0000-01-01T00:00:00.000000000Z", buf, 60));
+
+  return EXIT_SUCCESS;
+}
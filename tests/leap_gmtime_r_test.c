@@ -0,0 +1,69 @@
+#define _DEFAULT_SOURCE
+
+#include "leap.h"
+#include "leap_tm.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+static bool equal_tm(const struct tm *lhs, const struct tm *rhs) {
+  return lhs->tm_sec == rhs->tm_sec && lhs->tm_min == rhs->tm_min && lhs->tm_hour == rhs->tm_hour &&
+         lhs->tm_mday == rhs->tm_mday && lhs->tm_mon == rhs->tm_mon && lhs->tm_year == rhs->tm_year &&
+         lhs->tm_wday == rhs->tm_wday && lhs->tm_yday == rhs->tm_yday && lhs->tm_isdst == rhs->tm_isdst;
+}
+
+int leap_gmtime_r_test(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  struct tm tm;
+  time_t t = 0;
+  assert(&tm == leap_gmtime_r(&t, &tm));
+  assert(equal_tm(&(struct tm){.tm_year = 70, .tm_mday = 1, .tm_wday = 4}, &tm));
+
+  /*
+   * One second before the epoch: Wednesday, the 365th day of 1969.
+   */
+  t = -1;
+  (void)leap_gmtime_r(&t, &tm);
+  assert(equal_tm(
+      &(struct tm){.tm_sec = 59, .tm_min = 59, .tm_hour = 23, .tm_mday = 31, .tm_mon = 11, .tm_year = 69, .tm_wday = 3,
+                   .tm_yday = 364},
+      &tm));
+
+  /*
+   * Leap day 2024 fell on a Thursday, the sixtieth day of the year.
+   */
+  t = 1709251199;
+  (void)leap_gmtime_r(&t, &tm);
+  assert(29 == tm.tm_mday && 1 == tm.tm_mon && 124 == tm.tm_year && 4 == tm.tm_wday && 59 == tm.tm_yday);
+
+#if defined(__unix__) || defined(__APPLE__)
+  /*
+   * Agree with the C library, far into the past and future wherever time_t
+   * reaches.
+   */
+  const int64_t step = sizeof(time_t) < sizeof(int64_t) ? 8191 : 86400 * INT64_C(3652425) / 1000 + 7919;
+  for (int64_t i = -100000; i <= 100000; ++i) {
+    t = (time_t)(i * step);
+    struct tm libc;
+    if (gmtime_r(&t, &libc) == NULL) {
+      continue;
+    }
+    assert(&tm == leap_gmtime_r(&t, &tm));
+    assert(equal_tm(&libc, &tm));
+  }
+#endif
+
+  if (sizeof(time_t) >= sizeof(int64_t)) {
+    t = (time_t)((int64_t)LEAP_ABS_MAX - LEAP_MCMLXX + 1) * 86400;
+    errno = 0;
+    assert(NULL == leap_gmtime_r(&t, &tm));
+    assert(EOVERFLOW == errno);
+  }
+
+  return EXIT_SUCCESS;
+}
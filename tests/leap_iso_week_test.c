@@ -0,0 +1,66 @@
+#include "leap.h"
+#include "leap_iso.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+#define N 1000
+
+int leap_iso_week_test(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  /*
+   * 2004-12-31 fell in week 53 of 2004; 2005-01-02 too. 2008-12-29 opened
+   * week 1 of 2009; 2010-01-03 closed week 53 of 2009.
+   */
+  assert(equal_leap_iso((struct leap_iso){2004, 53, 5}, leap_iso_week(leap_abs_from(2004, 12, 31))));
+  assert(equal_leap_iso((struct leap_iso){2004, 53, 7}, leap_iso_week(leap_abs_from(2005, 1, 2))));
+  assert(equal_leap_iso((struct leap_iso){2005, 1, 1}, leap_iso_week(leap_abs_from(2005, 1, 3))));
+  assert(equal_leap_iso((struct leap_iso){2009, 1, 1}, leap_iso_week(leap_abs_from(2008, 12, 29))));
+  assert(equal_leap_iso((struct leap_iso){2009, 53, 7}, leap_iso_week(leap_abs_from(2010, 1, 3))));
+  assert(equal_leap_iso((struct leap_iso){2024, 9, 4}, leap_iso_week(leap_abs_from(2024, 2, 29))));
+  assert(equal_leap_iso((struct leap_iso){1970, 1, 4}, leap_iso_week(LEAP_MCMLXX)));
+
+  /*
+   * Year 0 opened on a Saturday, in the last week of ISO year -1.
+   */
+  assert(equal_leap_iso((struct leap_iso){-1, 52, 6}, leap_iso_week(0)));
+
+  assert(leap_abs_from(2008, 12, 29) == leap_iso_from(2009, 1, 1));
+  assert(leap_abs_from(2010, 1, 3) == leap_iso_from(2009, 53, 7));
+  assert(leap_abs_from(2010, 1, 4) == leap_iso_from(2009, 53, 8));
+  assert(leap_abs_from(2010, 1, 4) == leap_iso_from(2010, 1, 1));
+
+  /*
+   * Round trips, and weeks follow on day by day.
+   */
+  static int abs_day[N], year[N], week[N], wday[N], back[N];
+  for (int i = 0; i < N; ++i) {
+    abs_day[i] = (i - N / 2) * 3652429;
+  }
+  abs_day[0] = LEAP_ABS_MIN;
+  abs_day[1] = LEAP_ABS_MAX;
+  const struct leap_iso_cols cols = {year, week, wday};
+  leap_iso_week_n(abs_day, N, &cols);
+  leap_iso_from_n(&cols, N, back);
+  for (int i = 0; i < N; ++i) {
+    const struct leap_iso iso = leap_iso_week(abs_day[i]);
+    assert(equal_leap_iso(iso, (struct leap_iso){year[i], week[i], wday[i]}));
+    assert(abs_day[i] == leap_iso_from_iso(iso));
+    assert(abs_day[i] == back[i]);
+    assert(1 <= iso.week && iso.week <= 53 && 1 <= iso.wday && iso.wday <= 7);
+  }
+  for (int day = leap_abs_from(1999, 12, 1); day < leap_abs_from(2030, 2, 1); ++day) {
+    const struct leap_iso iso = leap_iso_week(day);
+    const struct leap_iso next = leap_iso_week(day + 1);
+    if (iso.wday < 7) {
+      assert(equal_leap_iso((struct leap_iso){iso.year, iso.week, iso.wday + 1}, next));
+    } else {
+      assert(1 == next.wday);
+      assert((iso.year == next.year && iso.week + 1 == next.week) || (iso.year + 1 == next.year && 1 == next.week));
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
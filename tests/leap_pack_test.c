@@ -0,0 +1,56 @@
+#include "leap.h"
+#include "leap_pack.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+#define N 1000
+
+static int compare(const void *lhs, const void *rhs) {
+  const uint32_t l = *(const uint32_t *)lhs, r = *(const uint32_t *)rhs;
+  return (l > r) - (l < r);
+}
+
+int leap_pack_test(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  const struct leap_date leap = {2024, 2, 29};
+  assert(equal_leap_date(leap, leap_unpack(leap_pack(leap))));
+  assert(leap_pack(leap) < leap_pack((struct leap_date){2024, 3, 1}));
+  assert(leap_pack((struct leap_date){-1, 12, 31}) < leap_pack((struct leap_date){0, 1, 1}));
+  assert(leap_abs_pack(LEAP_MCMLXX) == leap_pack((struct leap_date){1970, 1, 1}));
+  assert(LEAP_MCMLXX == leap_pack_abs(leap_pack((struct leap_date){1970, 1, 1})));
+
+  /*
+   * The extremes pack into the lowest and highest years.
+   */
+  assert(LEAP_PACK_ABS_MIN == leap_day(LEAP_PACK_YEAR_MIN));
+  assert(LEAP_PACK_ABS_MAX == leap_day(LEAP_PACK_YEAR_MAX + 1) - 1);
+  assert(leap_abs_pack(LEAP_PACK_ABS_MIN) == (0 << 9 | 1 << 5 | 1));
+  assert(leap_abs_pack(LEAP_PACK_ABS_MAX) == ((UINT32_MAX & ~UINT32_C(511)) | 12 << 5 | 31));
+  assert(LEAP_PACK_ABS_MIN == leap_pack_abs(leap_abs_pack(LEAP_PACK_ABS_MIN)));
+  assert(LEAP_PACK_ABS_MAX == leap_pack_abs(leap_abs_pack(LEAP_PACK_ABS_MAX)));
+
+  /*
+   * Sorting packed dates as integers sorts them by day.
+   */
+  int day[N], round[N];
+  uint32_t packed[N], sorted[N];
+  for (int i = 0; i < N; ++i) {
+    day[i] = rand() % 2000000 - 1000000;
+  }
+  leap_abs_pack_n(day, N, packed);
+  leap_pack_abs_n(packed, N, round);
+  for (int i = 0; i < N; ++i) {
+    assert(day[i] == round[i]);
+    assert(packed[i] == leap_abs_pack(day[i]));
+    sorted[i] = packed[i];
+  }
+  qsort(sorted, N, sizeof(*sorted), compare);
+  for (int i = 1; i < N; ++i) {
+    assert(leap_pack_abs(sorted[i - 1]) <= leap_pack_abs(sorted[i]));
+  }
+
+  return EXIT_SUCCESS;
+}
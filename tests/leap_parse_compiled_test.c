@@ -0,0 +1,94 @@
+#include "leap.h"
+#include "leap_format.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define N 1000
+
+static bool parse(const struct leap_format *format, const char *text, struct leap_date *date) {
+  return leap_parse_compiled(format, text, strlen(text), date);
+}
+
+int leap_parse_compiled_test(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  struct leap_format dmy, bdy, yj, y2, pct;
+  assert(leap_format_compile(&dmy, "%d/%m/%Y"));
+  assert(leap_format_compile(&bdy, "%b %d %Y"));
+  assert(leap_format_compile(&yj, "%Y%j"));
+  assert(leap_format_compile(&y2, "%y-%m-%e"));
+  assert(leap_format_compile(&pct, "%%%Y"));
+  assert(5 == dmy.n && 5 == bdy.n && 2 == yj.n);
+
+  struct leap_date date = {0, 0, 0};
+  assert(parse(&dmy, "29/02/2024", &date));
+  assert(equal_leap_date((struct leap_date){2024, 2, 29}, date));
+  assert(parse(&dmy, "1/2/3", &date));
+  assert(equal_leap_date((struct leap_date){3, 2, 1}, date));
+  assert(parse(&bdy, "Feb 29 2024", &date));
+  assert(equal_leap_date((struct leap_date){2024, 2, 29}, date));
+  assert(parse(&bdy, "SEPTEMBER   3 1752", &date));
+  assert(equal_leap_date((struct leap_date){1752, 9, 3}, date));
+  assert(parse(&bdy, "mayday", &date) == false);
+  assert(parse(&bdy, "may 31 2000", &date));
+  assert(equal_leap_date((struct leap_date){2000, 5, 31}, date));
+  assert(parse(&yj, "2024060", &date));
+  assert(equal_leap_date((struct leap_date){2024, 2, 29}, date));
+  assert(parse(&y2, "68-12- 1", &date));
+  assert(equal_leap_date((struct leap_date){2068, 12, 1}, date));
+  assert(parse(&y2, "69-01-01", &date));
+  assert(equal_leap_date((struct leap_date){1969, 1, 1}, date));
+  assert(parse(&pct, "%1970", &date));
+  assert(equal_leap_date((struct leap_date){1970, 1, 1}, date));
+
+  /*
+   * Invalid inputs leave the date alone.
+   */
+  date = (struct leap_date){0, 0, 0};
+  assert(!parse(&dmy, "29/02/2023", &date));
+  assert(!parse(&dmy, "31/04/2024", &date));
+  assert(!parse(&dmy, "01/13/2024", &date));
+  assert(!parse(&dmy, "01/01/2024 ", &date));
+  assert(!parse(&dmy, "01-01-2024", &date));
+  assert(!parse(&bdy, "Foo 01 2024", &date));
+  assert(!parse(&yj, "2023366", &date));
+  assert(!parse(&yj, "2024000", &date));
+  assert(!parse(&yj, "2023", &date));
+  assert(equal_leap_date((struct leap_date){0, 0, 0}, date));
+
+  /*
+   * Unknown conversions and overlong formats fail to compile.
+   */
+  assert(!leap_format_compile(&dmy, "%Q"));
+  assert(!leap_format_compile(&dmy, "%Y%m%d%Y%m%d%Y%m%d%Y%m%d%Y%m%d%Y%m%d%Y%m%d%Y%m%d%Y%m%d%Y%m%d%Y%m%d"));
+
+  /*
+   * Batches agree with single parses; every ninth field breaks.
+   */
+  static char buf[N][24];
+  static const char *text[N];
+  static size_t len[N];
+  static int abs_day[N];
+  static uint64_t invalid[(N + 63) / 64];
+  static const char *const mon[] = {"Jan", "feb", "MAR", "April", "may", "June",
+                                    "jul", "Aug", "sep", "October", "nov", "DECEMBER"};
+  for (int i = 0; i < N; ++i) {
+    const struct leap_date d = leap_abs_date(leap_abs_from(1900, 1, 1) + i * 97);
+    (void)snprintf(buf[i], sizeof(buf[i]), "%s %d %d%s", mon[d.month - 1], d.day, d.year, i % 9 == 0 ? "x" : "");
+    text[i] = buf[i];
+    len[i] = strlen(buf[i]);
+  }
+  assert(leap_format_compile(&bdy, "%b %d %Y"));
+  assert((N + 8) / 9 == leap_parse_compiled_n(&bdy, text, len, N, abs_day, invalid));
+  for (int i = 0; i < N; ++i) {
+    const bool bad = (invalid[i / 64] >> (i % 64) & 1) != 0;
+    assert(bad == (i % 9 == 0));
+    assert(abs_day[i] == (bad ? 0 : leap_abs_from(1900, 1, 1) + i * 97));
+  }
+
+  return EXIT_SUCCESS;
+}
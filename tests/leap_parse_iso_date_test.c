@@ -0,0 +1,91 @@
+#include "leap.h"
+#include "leap_parse.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define N 1000
+
+int leap_parse_iso_date_test(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  int abs_day = -1;
+  assert(leap_parse_iso_date("2024-02-29", LEAP_ISO_DATE_EXTENDED, &abs_day));
+  assert(leap_abs_from(2024, 2, 29) == abs_day);
+  assert(leap_parse_iso_date("19700101", LEAP_ISO_DATE_BASIC, &abs_day));
+  assert(LEAP_MCMLXX == abs_day);
+  assert(leap_parse_iso_date("2024-366", LEAP_ISO_DATE_ORDINAL, &abs_day));
+  assert(leap_abs_from(2024, 12, 31) == abs_day);
+  assert(leap_parse_iso_date("0000-01-01", LEAP_ISO_DATE_EXTENDED, &abs_day));
+  assert(0 == abs_day);
+  assert(leap_parse_iso_date("9999-12-31", LEAP_ISO_DATE_EXTENDED, &abs_day));
+  assert(leap_abs_from(9999, 12, 31) == abs_day);
+
+  /*
+   * Invalid dates leave the day alone.
+   */
+  abs_day = -1;
+  static const char *const extended[] = {"2023-02-29", "2024-13-01", "2024-00-10", "2024-04-31", "2024-01-00",
+                                         "2024/01/01", "2024-1-01x", "20a4-01-01", "2024-01-:1", "2024-01-0/"};
+  for (size_t i = 0; i < sizeof(extended) / sizeof(extended[0]); ++i) {
+    assert(!leap_parse_iso_date(extended[i], LEAP_ISO_DATE_EXTENDED, &abs_day));
+  }
+  assert(!leap_parse_iso_date("20230229", LEAP_ISO_DATE_BASIC, &abs_day));
+  assert(!leap_parse_iso_date("2024-01-01", LEAP_ISO_DATE_BASIC, &abs_day));
+  assert(!leap_parse_iso_date("2023-366", LEAP_ISO_DATE_ORDINAL, &abs_day));
+  assert(!leap_parse_iso_date("2023-000", LEAP_ISO_DATE_ORDINAL, &abs_day));
+  assert(!leap_parse_iso_date("20230100", LEAP_ISO_DATE_ORDINAL, &abs_day));
+  assert(-1 == abs_day);
+
+  /*
+   * Batches flag invalid rows in the bitmap and agree with single parses.
+   * Every seventh row breaks.
+   */
+  static char text[N * 11 + 1];
+  static int days[N];
+  static uint64_t invalid[(N + 63) / 64];
+  for (int i = 0; i < N; ++i) {
+    const struct leap_date date = leap_abs_date(leap_abs_from(1600, 1, 1) + i * 331);
+    (void)snprintf(text + i * 11, 12, "%04d-%02d-%02d,", date.year, date.month, i % 7 == 0 ? 32 : date.day);
+  }
+  assert((N + 6) / 7 == leap_parse_iso_date_n(text, 11, N, LEAP_ISO_DATE_EXTENDED, days, invalid));
+  for (int i = 0; i < N; ++i) {
+    const bool bad = (invalid[i / 64] >> (i % 64) & 1) != 0;
+    assert(bad == (i % 7 == 0));
+    abs_day = 0;
+    assert(!bad == leap_parse_iso_date(text + i * 11, LEAP_ISO_DATE_EXTENDED, &abs_day));
+    assert(abs_day == days[i]);
+  }
+
+  /*
+   * Basic and ordinal forms, packed back to back.
+   */
+  for (int i = 0; i < N; ++i) {
+    const int day = leap_abs_from(1, 1, 1) + i * 3613;
+    const struct leap_date date = leap_abs_date(day);
+    char field[48];
+    (void)snprintf(field, sizeof(field), "%04d%02d%02d", date.year, date.month, date.day);
+    memcpy(text + i * 8, field, 8);
+  }
+  assert(0 == leap_parse_iso_date_n(text, 8, N, LEAP_ISO_DATE_BASIC, days, invalid));
+  for (int i = 0; i < N; ++i) {
+    assert(leap_abs_from(1, 1, 1) + i * 3613 == days[i]);
+  }
+  for (int i = 0; i < N; ++i) {
+    const int day = leap_abs_from(1, 1, 1) + i * 3613;
+    const struct leap_date date = leap_abs_date(day);
+    char field[48];
+    (void)snprintf(field, sizeof(field), "%04d-%03d", date.year, day - leap_day(date.year) + 1);
+    memcpy(text + i * 8, field, 8);
+  }
+  assert(0 == leap_parse_iso_date_n(text, 8, N, LEAP_ISO_DATE_ORDINAL, days, invalid));
+  for (int i = 0; i < N; ++i) {
+    assert(leap_abs_from(1, 1, 1) + i * 3613 == days[i]);
+  }
+  assert(0 == invalid[0] && 0 == invalid[(N - 1) / 64]);
+
+  return EXIT_SUCCESS;
+}
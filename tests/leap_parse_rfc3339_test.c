@@ -0,0 +1,84 @@
+#include "leap.h"
+#include "leap_parse.h"
+#include "leap_time.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+static bool parse(const char *text, int64_t *ns) { return leap_parse_rfc3339(text, strlen(text), LEAP_MCMLXX, ns); }
+
+int leap_parse_rfc3339_test(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  int64_t ns = 0;
+  assert(parse("1970-01-01T00:00:00Z", &ns));
+  assert(0 == ns);
+  assert(parse("1969-12-31T23:59:59.999999999Z", &ns));
+  assert(-1 == ns);
+  assert(parse("1970-01-01t05:30:00.5+05:30", &ns));
+  assert(500000000 == ns);
+  assert(parse("1969-12-31 16:00:00z", &ns));
+  assert(-8 * INT64_C(3600000000000) == ns);
+  assert(parse("1969-12-31T16:00:00-08:00", &ns));
+  assert(0 == ns);
+
+  /*
+   * The example from the feed: leap day 2024, offset east of Greenwich.
+   */
+  assert(parse("2024-02-29T23:59:59.123456789+05:30", &ns));
+  const struct leap_time time = leap_time_ns(ns, LEAP_MCMLXX);
+  assert(equal_leap_time((struct leap_time){{2024, 2, 29}, 18, 29, 59, 123456789}, time));
+
+  /*
+   * More than nine fractional digits truncate; a leap second carries.
+   */
+  assert(parse("2024-02-29T23:59:59.1234567891234Z", &ns));
+  assert(123456789 == leap_time_ns(ns, LEAP_MCMLXX).subsec);
+  assert(parse("2016-12-31T23:59:60Z", &ns));
+  assert(equal_leap_time((struct leap_time){{2017, 1, 1}, 0, 0, 0, 0}, leap_time_ns(ns, LEAP_MCMLXX)));
+
+  /*
+   * The extremes of 64-bit nanoseconds parse; one beyond does not.
+   */
+  assert(parse("2262-04-11T23:47:16.854775807Z", &ns));
+  assert(INT64_MAX == ns);
+  assert(!parse("2262-04-11T23:47:16.854775808Z", &ns));
+  assert(parse("1677-09-21T00:12:43.145224192Z", &ns));
+  assert(INT64_MIN == ns);
+  assert(!parse("1677-09-21T00:12:43.145224191Z", &ns));
+
+  ns = 42;
+  static const char *const bad[] = {
+      "2023-02-29T00:00:00Z",      "2024-02-29T24:00:00Z",  "2024-02-29T23:60:00Z",     "2024-02-29T23:59:61Z",
+      "2024-02-29T23:59:59",       "2024-02-29X23:59:59Z",  "2024-02-29T23:59:59.Z",    "2024-02-29T23:59:59+0530",
+      "2024-02-29T23:59:59+24:00", "2024-02-29T23:59:59Zx", "2024-02-29T23-59:59Z",     "",
+      "2024-02-29T23:59:59.5",     "2024-02-29T23:59:59.123456789",
+  };
+  for (size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); ++i) {
+    assert(!parse(bad[i], &ns));
+  }
+  assert(42 == ns);
+
+  /*
+   * Streams records, dropping carriage returns and leaving the unterminated
+   * tail behind.
+   */
+  static const char stream[] = "1970-01-01T00:00:00Z\n"
+                               "bad\r\n"
+                               "1970-01-01T00:00:01Z\r\n"
+                               "1970-01-01T00:00:02Z";
+  int64_t out[4];
+  uint64_t invalid[1];
+  size_t used = 0;
+  assert(3 == leap_parse_rfc3339_n(stream, sizeof(stream) - 1, '\n', LEAP_MCMLXX, out, invalid, 4, &used));
+  assert(0 == out[0] && 0 == out[1] && 1000000000 == out[2]);
+  assert(UINT64_C(2) == invalid[0]);
+  assert(strlen(stream) - 20 == used);
+  assert(1 == leap_parse_rfc3339_n(stream, sizeof(stream) - 1, '\n', LEAP_MCMLXX, out, invalid, 1, &used));
+  assert(21 == used);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,45 @@
+#include "leap.h"
+#include "leap_stats.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+int leap_stats_test(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  leap_stats_reset();
+  assert(equal_leap_date((struct leap_date){2024, 3, 1}, leap_abs_date(leap_abs_from(2024, 3, 1))));
+  const struct leap_stats stats = leap_stats_snapshot();
+
+#ifdef LEAPC_STATS
+  assert(1 == stats.leap_abs_from);
+  assert(1 == stats.leap_abs_date);
+  assert(1 == stats.leap_date);
+  assert(1 == stats.leap_from);
+
+#ifndef LEAPC_WCET
+  /*
+   * The first of March steps over January and February. Closed forms neither
+   * step nor loop.
+   */
+  assert(2 == stats.leap_date_step);
+  assert(stats.leap_off_loop > 0);
+#endif
+#ifndef LEAPC_NO_DIVIDE
+  assert(stats.quo_mod > 0);
+#endif
+
+  leap_stats_reset();
+  assert(0 == leap_stats_snapshot().quo_mod);
+#else
+  /*
+   * Without LEAPC_STATS, nothing counts.
+   */
+  assert(0 == stats.leap_abs_from);
+  assert(0 == stats.leap_date_step);
+  assert(0 == stats.quo_mod);
+#endif
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,49 @@
+#include "leap_time.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define N 1000
+
+int leap_time_ns_n_test(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  static int64_t ns[N];
+  static int year[N], month[N], day[N], hour[N], min[N], sec[N], nsec[N];
+  uint64_t x = 88172645463325252U;
+  for (int i = 0; i < N; ++i) {
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    ns[i] = (int64_t)x;
+  }
+  ns[0] = INT64_MIN;
+  ns[1] = INT64_MAX;
+  ns[2] = -1;
+  ns[3] = 0;
+
+  /*
+   * Every field agrees with the single-timestamp conversion.
+   */
+  leap_time_ns_n(ns, N, LEAP_MCMLXX, &(struct leap_time_cols){year, month, day, hour, min, sec, nsec});
+  for (int i = 0; i < N; ++i) {
+    const struct leap_time want = leap_time_ns(ns[i], LEAP_MCMLXX);
+    assert(equal_leap_time(want, (struct leap_time){{year[i], month[i], day[i]}, hour[i], min[i], sec[i], nsec[i]}));
+  }
+
+  /*
+   * Null columns skip their fields.
+   */
+  for (int i = 0; i < N; ++i) {
+    year[i] = month[i] = -1;
+  }
+  leap_time_ns_n(ns, N, LEAP_MCMLXX, &(struct leap_time_cols){.month = month});
+  for (int i = 0; i < N; ++i) {
+    assert(-1 == year[i]);
+    assert(leap_time_ns(ns[i], LEAP_MCMLXX).date.month == month[i]);
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,46 @@
+#include "leap_time.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+int leap_time_test(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  assert(equal_leap_time((struct leap_time){{1970, 1, 1}, 0, 0, 0, 0}, leap_time(0, LEAP_MCMLXX)));
+  assert(equal_leap_time((struct leap_time){{1969, 12, 31}, 23, 59, 59, 0}, leap_time(-1, LEAP_MCMLXX)));
+  assert(equal_leap_time((struct leap_time){{2024, 2, 29}, 23, 59, 59, 0}, leap_time(1709251199, LEAP_MCMLXX)));
+  assert(equal_leap_time((struct leap_time){{1900, 1, 1}, 0, 0, 1, 0}, leap_time(1, LEAP_MCM)));
+
+  /*
+   * Fractions of a second floor towards the past.
+   */
+  assert(equal_leap_time((struct leap_time){{1969, 12, 31}, 23, 59, 59, 999}, leap_time_ms(-1, LEAP_MCMLXX)));
+  assert(equal_leap_time((struct leap_time){{1970, 1, 1}, 0, 0, 1, 500000}, leap_time_us(1500000, LEAP_MCMLXX)));
+  assert(equal_leap_time((struct leap_time){{1969, 12, 31}, 23, 59, 59, 999999999}, leap_time_ns(-1, LEAP_MCMLXX)));
+
+  /*
+   * Every 64-bit nanosecond timestamp converts and converts back.
+   */
+  const struct leap_time ns_min = {{1677, 9, 21}, 0, 12, 43, 145224192};
+  const struct leap_time ns_max = {{2262, 4, 11}, 23, 47, 16, 854775807};
+  assert(equal_leap_time(ns_min, leap_time_ns(INT64_MIN, LEAP_MCMLXX)));
+  assert(equal_leap_time(ns_max, leap_time_ns(INT64_MAX, LEAP_MCMLXX)));
+  assert(INT64_MIN == leap_time_from_ns(ns_min, LEAP_MCMLXX));
+  assert(INT64_MAX == leap_time_from_ns(ns_max, LEAP_MCMLXX));
+
+  for (int64_t sec = -86400 * 3; sec < 86400 * 3; sec += 997) {
+    assert(sec == leap_time_from(leap_time(sec, LEAP_MCMLXX), LEAP_MCMLXX));
+    assert(sec * 1000 + 7 == leap_time_from_ms(leap_time_ms(sec * 1000 + 7, LEAP_MCMLXX), LEAP_MCMLXX));
+    assert(sec * 1000000 - 7 == leap_time_from_us(leap_time_us(sec * 1000000 - 7, LEAP_MCMLXX), LEAP_MCMLXX));
+  }
+
+  /*
+   * Times of day out of range carry into the date.
+   */
+  assert(86400 == leap_time_from((struct leap_time){{1970, 1, 1}, 24, 0, 0, 0}, LEAP_MCMLXX));
+  assert(-1 == leap_time_from((struct leap_time){{1970, 1, 1}, 0, 0, -1, 0}, LEAP_MCMLXX));
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,70 @@
+#define _DEFAULT_SOURCE
+
+#include "leap.h"
+#include "leap_tm.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+int leap_timegm_test(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  struct tm tm = {.tm_year = 70, .tm_mday = 1};
+  assert(0 == leap_timegm(&tm));
+  assert(4 == tm.tm_wday);
+
+  /*
+   * Normalise out-of-range fields: the 32nd of January 2024 at 24:00 is
+   * Friday, the second of February at midnight.
+   */
+  tm = (struct tm){.tm_hour = 24, .tm_mday = 32, .tm_year = 124, .tm_isdst = 1};
+  assert(1706832000 == leap_timegm(&tm));
+  assert(2 == tm.tm_mday && 1 == tm.tm_mon && 0 == tm.tm_hour && 5 == tm.tm_wday && 32 == tm.tm_yday);
+  assert(0 == tm.tm_isdst);
+
+  /*
+   * Negative fields borrow: month -1 of 1970 is December 1969, second -1 is
+   * the previous minute.
+   */
+  tm = (struct tm){.tm_sec = -1, .tm_mday = 1, .tm_mon = -1, .tm_year = 70};
+  assert(-31 * 86400 - 1 == leap_timegm(&tm));
+  assert(30 == tm.tm_mday && 10 == tm.tm_mon && 69 == tm.tm_year && 59 == tm.tm_sec);
+
+#if defined(__unix__) || defined(__APPLE__)
+  /*
+   * Agree with the C library over a spread of unnormalised fields.
+   */
+  unsigned x = 2463534242U;
+  for (int i = 0; i < 100000; ++i) {
+    int field[6];
+    for (int j = 0; j < 6; ++j) {
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      field[j] = (int)(x % 20001U) - 10000;
+    }
+    struct tm libc = {.tm_sec = field[0],
+                      .tm_min = field[1],
+                      .tm_hour = field[2],
+                      .tm_mday = field[3],
+                      .tm_mon = field[4],
+                      .tm_year = field[5] % 2000};
+    struct tm leap = libc;
+    assert(timegm(&libc) == leap_timegm(&leap));
+    assert(libc.tm_year == leap.tm_year && libc.tm_mon == leap.tm_mon && libc.tm_mday == leap.tm_mday &&
+           libc.tm_hour == leap.tm_hour && libc.tm_min == leap.tm_min && libc.tm_sec == leap.tm_sec &&
+           libc.tm_wday == leap.tm_wday && libc.tm_yday == leap.tm_yday);
+  }
+#endif
+
+  tm = (struct tm){.tm_mday = 1, .tm_year = INT_MAX};
+  errno = 0;
+  assert((time_t)-1 == leap_timegm(&tm));
+  assert(EOVERFLOW == errno);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,76 @@
+#include "leap.h"
+#include "leap_trunc.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define N 1000
+
+/*
+ * Truncates the slow way: decodes the full date and encodes the bucket's
+ * first day.
+ */
+static int trunc_ref(int abs_day, enum leap_unit unit) {
+  const struct leap_date date = leap_abs_date(abs_day);
+  switch (unit) {
+  case LEAP_UNIT_WEEK:
+    return abs_day - ((abs_day + 5) % 7 + 7) % 7;
+  case LEAP_UNIT_MONTH:
+    return leap_abs_from(date.year, date.month, 1);
+  case LEAP_UNIT_QUARTER:
+    return leap_abs_from(date.year, date.month - (date.month - 1) % 3, 1);
+  case LEAP_UNIT_YEAR:
+    return leap_abs_from(date.year, 1, 1);
+  default:
+    return abs_day;
+  }
+}
+
+int leap_trunc_test(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  const int leap_day = leap_abs_from(2024, 2, 29);
+  assert(leap_abs_from(2024, 2, 26) == leap_trunc(leap_day, LEAP_UNIT_WEEK));
+  assert(leap_abs_from(2024, 2, 1) == leap_trunc(leap_day, LEAP_UNIT_MONTH));
+  assert(leap_abs_from(2024, 1, 1) == leap_trunc(leap_day, LEAP_UNIT_QUARTER));
+  assert(leap_abs_from(2024, 1, 1) == leap_trunc(leap_day, LEAP_UNIT_YEAR));
+  assert(leap_abs_from(2024, 1, 1) == leap_trunc(leap_abs_from(2024, 3, 31), LEAP_UNIT_QUARTER));
+  assert(leap_abs_from(2024, 4, 1) == leap_trunc(leap_abs_from(2024, 4, 1), LEAP_UNIT_QUARTER));
+  assert(leap_abs_from(2024, 10, 1) == leap_trunc(leap_abs_from(2024, 12, 31), LEAP_UNIT_QUARTER));
+  assert(leap_day == leap_trunc(leap_day, LEAP_UNIT_DAY));
+
+  /*
+   * One second before 1970 falls in the last quarter of 1969, which began on a
+   * Wednesday in the week starting Monday 29 September.
+   */
+  assert(-92 * 86400 == leap_trunc_time(-1, LEAP_MCMLXX, LEAP_UNIT_QUARTER));
+  assert(-3 * 86400 == leap_trunc_time(0, LEAP_MCMLXX, LEAP_UNIT_WEEK));
+  assert(-86400 * INT64_C(1000000000) == leap_trunc_time_ns(-1, LEAP_MCMLXX, LEAP_UNIT_DAY));
+
+  /*
+   * Every unit agrees with decoding and encoding, for days and batches.
+   */
+  static int abs_day[N], result[N];
+  static int64_t ns[N], ns_result[N];
+  for (int i = 0; i < N; ++i) {
+    abs_day[i] = leap_abs_from(1999, 12, 25) + i * 37 - 1000 * (i & 1);
+    ns[i] = (int64_t)(abs_day[i] - LEAP_MCMLXX) * 86400000000000 + i * INT64_C(86399999999);
+  }
+  abs_day[0] = LEAP_ABS_MIN + 100;
+  abs_day[1] = LEAP_ABS_MAX;
+  ns[0] = INT64_MAX;
+  for (enum leap_unit unit = LEAP_UNIT_DAY; unit <= LEAP_UNIT_YEAR; ++unit) {
+    leap_trunc_n(abs_day, N, unit, result);
+    leap_trunc_time_ns_n(ns, N, LEAP_MCMLXX, unit, ns_result);
+    for (int i = 0; i < N; ++i) {
+      assert(trunc_ref(abs_day[i], unit) == result[i]);
+      assert(leap_trunc(abs_day[i], unit) == result[i]);
+      assert(leap_trunc_time_ns(ns[i], LEAP_MCMLXX, unit) == ns_result[i]);
+      assert(ns_result[i] <= ns[i]);
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
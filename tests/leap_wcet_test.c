@@ -0,0 +1,111 @@
+#include "leap.h"
+#include "leap_stats.h"
+#include "quo_mod.h"
+
+#include <assert.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef LEAPC_WCET
+/*
+ * Counts the operations performed by one call. Resets the counters, evaluates
+ * the call and snapshots the counters.
+ */
+#define COUNT(call) (leap_stats_reset(), (void)(call), leap_stats_snapshot())
+
+static bool equal_leap_stats(struct leap_stats lhs, struct leap_stats rhs) {
+  return memcmp(&lhs, &rhs, sizeof(lhs)) == 0;
+}
+#endif
+
+int leap_wcet_test(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+#ifdef LEAPC_WCET
+  /*
+   * Every public function performs the same operations whatever its inputs.
+   * Compare counts at the extremes of the safe range against counts for an
+   * everyday input. Without LEAPC_STATS, every count is zero and the test
+   * proves nothing more than closed-form correctness.
+   */
+  const struct leap_stats is_leap_ops = COUNT(is_leap(2024));
+  assert(equal_leap_stats(is_leap_ops, COUNT(is_leap(INT_MIN))));
+  assert(equal_leap_stats(is_leap_ops, COUNT(is_leap(INT_MAX))));
+  assert(equal_leap_stats(is_leap_ops, COUNT(is_leap(1))));
+
+  const struct leap_stats leap_day_ops = COUNT(leap_day(2024));
+  assert(equal_leap_stats(leap_day_ops, COUNT(leap_day(LEAP_YEAR_MIN))));
+  assert(equal_leap_stats(leap_day_ops, COUNT(leap_day(LEAP_YEAR_MAX))));
+
+  const struct leap_stats leap_off_ops = COUNT(leap_off(2024, 59));
+  assert(equal_leap_stats(leap_off_ops, COUNT(leap_off(2024, 0))));
+  assert(equal_leap_stats(leap_off_ops, COUNT(leap_off(0, LEAP_ABS_MAX))));
+  assert(equal_leap_stats(leap_off_ops, COUNT(leap_off(0, LEAP_ABS_MIN))));
+  assert(equal_leap_stats(leap_off_ops, COUNT(leap_off(LEAP_YEAR_MAX, 364))));
+
+  const struct leap_stats leap_mday_ops = COUNT(leap_mday(2024, 2));
+  assert(equal_leap_stats(leap_mday_ops, COUNT(leap_mday(2023, 1))));
+  assert(equal_leap_stats(leap_mday_ops, COUNT(leap_mday(LEAP_YEAR_MAX, 12))));
+  assert(equal_leap_stats(leap_mday_ops, COUNT(leap_mday(0, -12000))));
+
+  const struct leap_stats leap_yday_ops = COUNT(leap_yday(2024, 3));
+  assert(equal_leap_stats(leap_yday_ops, COUNT(leap_yday(2024, 1))));
+  assert(equal_leap_stats(leap_yday_ops, COUNT(leap_yday(LEAP_YEAR_MIN, 12000))));
+
+  const struct leap_stats leap_date_ops = COUNT(leap_date(2024, 0));
+  assert(equal_leap_stats(leap_date_ops, COUNT(leap_date(2024, 365))));
+  assert(equal_leap_stats(leap_date_ops, COUNT(leap_date(0, LEAP_ABS_MIN))));
+  assert(equal_leap_stats(leap_date_ops, COUNT(leap_date(0, LEAP_ABS_MAX))));
+  assert(equal_leap_stats(leap_date_ops, COUNT(leap_date(LEAP_YEAR_MAX, -LEAP_ABS_MAX))));
+
+  const struct leap_stats leap_from_ops = COUNT(leap_from(2024, 1, 1));
+  assert(equal_leap_stats(leap_from_ops, COUNT(leap_from(2024, 12, 31))));
+  assert(equal_leap_stats(leap_from_ops, COUNT(leap_from(LEAP_YEAR_MIN + 1000, -12000, -366000))));
+  assert(equal_leap_stats(leap_from_ops, COUNT(leap_from(LEAP_YEAR_MAX - 1000, 12000, 366000))));
+
+  const struct leap_stats leap_abs_date_ops = COUNT(leap_abs_date(0));
+  assert(equal_leap_stats(leap_abs_date_ops, COUNT(leap_abs_date(LEAP_ABS_MIN))));
+  assert(equal_leap_stats(leap_abs_date_ops, COUNT(leap_abs_date(LEAP_ABS_MAX))));
+  assert(equal_leap_stats(leap_abs_date_ops, COUNT(leap_abs_date(LEAP_MCMLXX + 59))));
+
+  const struct leap_stats leap_abs_from_ops = COUNT(leap_abs_from(0, 1, 1));
+  assert(equal_leap_stats(leap_abs_from_ops, COUNT(leap_abs_from(LEAP_YEAR_MIN, 1, 1))));
+  assert(equal_leap_stats(leap_abs_from_ops, COUNT(leap_abs_from(LEAP_YEAR_MAX, 12, 31))));
+  assert(equal_leap_stats(leap_abs_from_ops, COUNT(leap_abs_from(2024, 2, 29))));
+
+  const struct leap_stats leap_abs_year_ops = COUNT(leap_abs_year(0));
+  assert(equal_leap_stats(leap_abs_year_ops, COUNT(leap_abs_year(LEAP_ABS_MIN))));
+  assert(equal_leap_stats(leap_abs_year_ops, COUNT(leap_abs_year(LEAP_ABS_MAX))));
+
+  const struct leap_stats leap_abs_year_month_ops = COUNT(leap_abs_year_month(0));
+  assert(equal_leap_stats(leap_abs_year_month_ops, COUNT(leap_abs_year_month(LEAP_ABS_MIN))));
+  assert(equal_leap_stats(leap_abs_year_month_ops, COUNT(leap_abs_year_month(LEAP_ABS_MAX))));
+
+  const struct leap_stats quo_mod_ops = COUNT(quo_mod(7, 2));
+  assert(equal_leap_stats(quo_mod_ops, COUNT(quo_mod(-7, 2))));
+  assert(equal_leap_stats(quo_mod_ops, COUNT(quo_mod(INT_MIN, 146097))));
+  assert(equal_leap_stats(quo_mod_ops, COUNT(quo_mod(0, -1))));
+
+#ifdef LEAPC_STATS
+  /*
+   * No loops: leap_off() never loops and leap_date() never steps.
+   */
+  assert(0 == leap_date_ops.leap_off_loop);
+  assert(0 == leap_date_ops.leap_date_step);
+#ifndef LEAPC_NO_DIVIDE
+  assert(3 == leap_day_ops.quo_mod);
+#endif
+#endif
+
+  /*
+   * Closed forms agree at the extremes.
+   */
+  assert(equal_leap_date((struct leap_date){LEAP_YEAR_MIN, 1, 1}, leap_abs_date(LEAP_ABS_MIN)));
+  assert(equal_leap_date((struct leap_date){LEAP_YEAR_MAX, 12, 31}, leap_abs_date(LEAP_ABS_MAX)));
+  assert(equal_leap_off((struct leap_off){2024, 365}, leap_off(2025, -1)));
+#endif
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,56 @@
+#include "leap.h"
+#include "leap_wday.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+#define N 1000
+
+int leap_wday_test(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  /*
+   * Year 0 opened on a Saturday and 1970 on a Thursday.
+   */
+  assert(6 == leap_wday(0));
+  assert(5 == leap_wday(-1));
+  assert(4 == leap_wday(LEAP_MCMLXX));
+  assert(4 == leap_wday_from(1970, 1, 1));
+  assert(3 == leap_wday_from(1969, 12, 31));
+
+  /*
+   * Leap day 2024 fell on a Thursday; 2000-02-29 on a Tuesday.
+   */
+  assert(4 == leap_wday_from(2024, 2, 29));
+  assert(2 == leap_wday_from(2000, 2, 29));
+
+  /*
+   * Normalises months and days out of range.
+   */
+  assert(leap_wday_from(2025, 1, 1) == leap_wday_from(2024, 13, 1));
+  assert(leap_wday_from(2024, 3, 1) == leap_wday_from(2024, 2, 30));
+  assert(leap_wday_from(2023, 12, 31) == leap_wday_from(2024, 1, 0));
+
+  /*
+   * Weekdays cycle through seven days, before and after day 0, and agree
+   * whether from absolute days, dates or batches.
+   */
+  static int abs_day[N], wday[N];
+  for (int i = 0; i < N; ++i) {
+    abs_day[i] = (i - N / 2) * 1234567;
+  }
+  abs_day[0] = LEAP_ABS_MIN;
+  abs_day[1] = LEAP_ABS_MAX;
+  leap_wday_n(abs_day, N, wday);
+  for (int i = 0; i < N; ++i) {
+    const struct leap_date date = leap_abs_date(abs_day[i]);
+    assert(0 <= wday[i] && wday[i] < 7);
+    assert(leap_wday(abs_day[i]) == wday[i]);
+    assert(leap_wday_from(date.year, date.month, date.day) == wday[i]);
+    assert((wday[i] + 1) % 7 == leap_wday(abs_day[i] + 1) || abs_day[i] == LEAP_ABS_MAX);
+    assert((wday[i] + 7) % 7 == leap_wday(abs_day[i] - 7) || abs_day[i] == LEAP_ABS_MIN);
+  }
+
+  return EXIT_SUCCESS;
+}
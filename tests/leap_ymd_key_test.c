@@ -0,0 +1,67 @@
+#include "leap.h"
+#include "leap_key.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+#define N 1000
+
+int leap_ymd_key_test(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+
+  int abs_day = -1;
+  assert(leap_ymd_key_to_abs(19700101, &abs_day) && LEAP_MCMLXX == abs_day);
+  assert(leap_ymd_key_to_abs(20240229, &abs_day) && leap_abs_from(2024, 2, 29) == abs_day);
+  assert(leap_ymd_key_to_abs(LEAP_YMD_KEY_MIN, &abs_day) && 0 == abs_day);
+  assert(leap_ymd_key_to_abs(LEAP_YMD_KEY_MAX, &abs_day) && LEAP_YMD_KEY_ABS_MAX == abs_day);
+  assert(LEAP_YMD_KEY_ABS_MAX == leap_day(214749) - 1);
+  assert(20240229 == leap_abs_to_ymd_key(leap_abs_from(2024, 2, 29)));
+  assert(LEAP_YMD_KEY_MIN == leap_abs_to_ymd_key(0));
+  assert(LEAP_YMD_KEY_MAX == leap_abs_to_ymd_key(LEAP_YMD_KEY_ABS_MAX));
+  assert(-1 == leap_abs_to_ymd_key(-1));
+  assert(-1 == leap_abs_to_ymd_key(LEAP_YMD_KEY_ABS_MAX + 1));
+
+  /*
+   * Invalid keys leave the day alone.
+   */
+  abs_day = -1;
+  assert(!leap_ymd_key_to_abs(20230229, &abs_day));
+  assert(!leap_ymd_key_to_abs(20240431, &abs_day));
+  assert(!leap_ymd_key_to_abs(20241301, &abs_day));
+  assert(!leap_ymd_key_to_abs(20240001, &abs_day));
+  assert(!leap_ymd_key_to_abs(20240100, &abs_day));
+  assert(!leap_ymd_key_to_abs(0, &abs_day));
+  assert(!leap_ymd_key_to_abs(-20240101, &abs_day));
+  assert(!leap_ymd_key_to_abs(INT32_MAX, &abs_day));
+  assert(-1 == abs_day);
+
+  /*
+   * Batches agree with the single conversions, keys valid or not.
+   */
+  int32_t key[N], round[N];
+  int day[N];
+  uint64_t invalid[(N + 63) / 64];
+  size_t bad = 0;
+  for (int i = 0; i < N; ++i) {
+    key[i] = leap_abs_to_ymd_key(rand() % 3652425);
+    if (i % 7 == 0) {
+      key[i] += rand() % 64 - 32;
+    }
+  }
+  size_t count = leap_ymd_key_to_abs_n(key, N, day, invalid);
+  for (int i = 0; i < N; ++i) {
+    int want = 0;
+    const bool ok = leap_ymd_key_to_abs(key[i], &want);
+    assert(want == day[i]);
+    assert(ok == !(invalid[i >> 6] >> (i & 63) & 1));
+    bad += !ok;
+  }
+  assert(bad == count);
+  leap_abs_to_ymd_key_n(day, N, round);
+  for (int i = 0; i < N; ++i) {
+    assert(round[i] == (invalid[i >> 6] >> (i & 63) & 1 ? LEAP_YMD_KEY_MIN : key[i]));
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -1,6 +1,7 @@
 #include "quo_mod.h"
 
 #include <assert.h>
+#include <limits.h>
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -44,5 +45,15 @@ int quo_mod_test(int argc, char **argv) {
       assert(lua_mod == qm.mod);
     }
 
+  /*
+   * Extremes of integer space.
+   */
+  assert(1 == quo_mod(INT_MIN, INT_MIN).quo);
+  assert(1 << 30 == quo_mod(INT_MIN, -2).quo);
+  assert(INT_MAX / 2 == quo_mod(INT_MAX, 2).quo);
+  assert(1 == quo_mod(INT_MAX, 2).mod);
+  assert(-1 == quo_mod(-1, INT_MAX).quo);
+  assert(INT_MAX - 1 == quo_mod(-1, INT_MAX).mod);
+
   return EXIT_SUCCESS;
 }
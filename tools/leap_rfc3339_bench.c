@@ -0,0 +1,126 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_rfc3339_bench.c
+ * \brief Benchmarks RFC 3339 parsing against the C library.
+ * \details Generates newline-separated RFC 3339 timestamps with nanosecond
+ * fractions and assorted offsets, then parses the buffer twice: once with
+ * leap_parse_rfc3339_n(), once with \c strptime and \c timegm plus hand-parsed
+ * fractions and offsets. Checks that both agree on every timestamp and prints
+ * the time per timestamp for each.
+ *
+ * Usage:
+ * \code
+ * leap_rfc3339_bench [count]
+ * \endcode
+ * Exits with success when both parsers agree.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#define _DEFAULT_SOURCE
+#define _XOPEN_SOURCE 700
+
+#include "leap.h"
+#include "leap_parse.h"
+#include "leap_time.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*!
+ * \brief Longest generated timestamp plus its newline.
+ */
+#define RECORD_MAX 40
+
+static double now(void) {
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/*
+ * Parses one record with the C library, answering zero on failure.
+ */
+static int64_t libc_parse(const char *text) {
+  struct tm tm;
+  memset(&tm, 0, sizeof(tm));
+  const char *at = strptime(text, "%Y-%m-%dT%H:%M:%S", &tm);
+  if (at == NULL) {
+    return 0;
+  }
+  int64_t frac = 0;
+  if (*at == '.') {
+    int digits = 0;
+    for (++at; *at >= '0' && *at <= '9'; ++at, ++digits) {
+      frac = frac * 10 + (*at - '0');
+    }
+    for (; digits < 9; ++digits) {
+      frac *= 10;
+    }
+  }
+  int off = 0;
+  if (*at == '+' || *at == '-') {
+    off = ((at[1] - '0') * 10 + (at[2] - '0')) * 3600 + ((at[4] - '0') * 10 + (at[5] - '0')) * 60;
+    off = *at == '-' ? -off : off;
+  }
+  return ((int64_t)timegm(&tm) - off) * 1000000000 + frac;
+}
+
+int main(int argc, char **argv) {
+  const size_t count = argc > 1 ? strtoul(argv[1], NULL, 0) : 1000000;
+  char *text = malloc(count * RECORD_MAX);
+  int64_t *want = malloc(count * sizeof(*want));
+  int64_t *got = malloc(count * sizeof(*got));
+  uint64_t *invalid = calloc((count + 63) / 64, sizeof(*invalid));
+  if (text == NULL || want == NULL || got == NULL || invalid == NULL) {
+    (void)fprintf(stderr, "out of memory\n");
+    return EXIT_FAILURE;
+  }
+
+  /*
+   * Timestamps from 1970 through 2099, one in three in UTC.
+   */
+  static const char *const offsets[] = {"Z", "+05:30", "-08:00"};
+  size_t len = 0;
+  uint64_t x = 88172645463325252U;
+  for (size_t i = 0; i < count; ++i) {
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    const struct leap_time t = leap_time_ns((int64_t)(x % (INT64_C(4102444800) * 1000000000)), LEAP_MCMLXX);
+    len += (size_t)snprintf(text + len, RECORD_MAX, "%04d-%02d-%02dT%02d:%02d:%02d.%09d%s\n", t.date.year,
+                            t.date.month, t.date.day, t.hour, t.min, t.sec, t.subsec, offsets[i % 3]);
+  }
+
+  double start = now();
+  size_t used;
+  const size_t parsed = leap_parse_rfc3339_n(text, len, '\n', LEAP_MCMLXX, got, invalid, count, &used);
+  const double leap_secs = now() - start;
+
+  start = now();
+  size_t i = 0;
+  for (const char *at = text; i < count; at = strchr(at, '\n') + 1) {
+    want[i++] = libc_parse(at);
+  }
+  const double libc_secs = now() - start;
+
+  size_t failures = parsed == count && used == len ? 0 : 1;
+  for (i = 0; i < parsed; ++i) {
+    if ((invalid[i / 64] >> (i % 64) & 1) != 0 || got[i] != want[i]) {
+      if (failures++ < 10) {
+        (void)fprintf(stderr, "timestamp %zu: want %lld got %lld\n", i, (long long)want[i], (long long)got[i]);
+      }
+    }
+  }
+  (void)printf("%zu timestamps\n", count);
+  (void)printf("leap_parse_rfc3339_n: %.1f ns each\n", leap_secs * 1e9 / (double)count);
+  (void)printf("strptime and timegm: %.1f ns each\n", libc_secs * 1e9 / (double)count);
+  (void)printf("%zu failures\n", failures);
+  free(invalid);
+  free(got);
+  free(want);
+  free(text);
+  return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
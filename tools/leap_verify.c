@@ -0,0 +1,608 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leap_verify.c
+ * \brief Exhaustive verification over the safe absolute-day range.
+ * \details Sweeps every absolute day from LEAP_ABS_MIN through LEAP_ABS_MAX, or
+ * some narrower range given on the command line, checking that:
+ *
+ *  - leap_abs_from() inverts leap_abs_date();
+ *  - leap_abs_date() agrees with a reference copy of the original iterative
+ *    algorithm;
+ *  - successive days advance the date by exactly one day, so that dates grow
+ *    monotonically and every month has its correct length.
+ *
+ * Further checks compare alternative backends and batch kernels against the
+ * library, starting with the closed-form decoders; each runs over the same
+ * chunks of days.
+ *
+ * Usage:
+ * \code
+ * leap_verify [-j threads] [first last]
+ * \endcode
+ * The sweep splits into chunks shared between worker threads, one per online
+ * processor by default. Exits with success when every check passes.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#include "leap.h"
+#include "leap_cal.h"
+#include "leap_format.h"
+#include "leap_iso.h"
+#include "leap_key.h"
+#include "leap_month.h"
+#include "leap_pack.h"
+#include "leap_parse.h"
+#include "leap_time.h"
+#include "leap_trunc.h"
+#include "leap_wday.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/*!
+ * \brief Days per chunk of work.
+ * \details Small enough to balance the load between threads, large enough to
+ * make the shared chunk counter cold.
+ */
+#define CHUNK_DAYS (1 << 20)
+
+/*!
+ * \brief Maximum number of failures reported per check.
+ */
+#define MAX_REPORTS 10
+
+/*
+ * Reference implementation. Copies the original iterative algorithm so that
+ * the library can change underneath without changing the yardstick. Uses its
+ * own floor quotient rather than quo_mod() for the same reason.
+ */
+
+static int ref_quo(int x, int y) {
+  int mod = x % y;
+  if (mod != 0 && (mod ^ y) < 0) {
+    mod += y;
+  }
+  return (x - mod) / y;
+}
+
+static int ref_add(int year) { return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0); }
+
+static int ref_day(int year) {
+  const int thru = ref_quo(year - 1, 4) - ref_quo(year - 1, 100) + ref_quo(year - 1, 400);
+  return year * 365 + thru + 1;
+}
+
+static int ref_mday(int year, int month) {
+  static const int MDAY[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  return MDAY[month - 1] + (month == 2 ? ref_add(year) : 0);
+}
+
+static struct leap_date ref_abs_date(int day_off) {
+  int year = 0;
+  int days = 366;
+  while (day_off < 0 || day_off >= days) {
+    int year0 = year + ref_quo(day_off, days);
+    day_off += ref_day(year) - ref_day(year0);
+    days = 365 + ref_add(year = year0);
+  }
+  int month = 1;
+  for (; month < 12; ++month) {
+    const int mday = ref_mday(year, month);
+    if (day_off < mday) {
+      break;
+    }
+    day_off -= mday;
+  }
+  return (struct leap_date){.year = year, .month = month, .day = day_off + 1};
+}
+
+/*!
+ * \brief Date of the following day.
+ * \details Steps a date forward by one day using nothing but the reference
+ * month lengths.
+ */
+static struct leap_date ref_next(struct leap_date date) {
+  if (date.day < ref_mday(date.year, date.month)) {
+    return (struct leap_date){date.year, date.month, date.day + 1};
+  }
+  if (date.month < 12) {
+    return (struct leap_date){date.year, date.month + 1, 1};
+  }
+  return (struct leap_date){date.year + 1, 1, 1};
+}
+
+/*!
+ * \brief Verification check.
+ * \details Runs over the inclusive day range \c first through \c last,
+ * answering the number of failures.
+ */
+struct check {
+  const char *name;
+  unsigned long (*run)(struct check *check, int first, int last);
+  atomic_ulong failures;
+  atomic_uint reports;
+};
+
+static void report(struct check *check, int day_off, const char *what, struct leap_date want,
+                   struct leap_date got) {
+  if (atomic_fetch_add(&check->reports, 1) >= MAX_REPORTS) {
+    return;
+  }
+  (void)fprintf(stderr, "%s: day %d: %s: want %d-%02d-%02d got %d-%02d-%02d\n", check->name, day_off, what,
+                want.year, want.month, want.day, got.year, got.month, got.day);
+}
+
+static unsigned long check_abs(struct check *check, int first, int last) {
+  unsigned long failures = 0;
+  struct leap_date prev = ref_abs_date(first);
+  for (int day_off = first;; ++day_off) {
+    const struct leap_date date = leap_abs_date(day_off);
+    const struct leap_date ref = day_off == first ? prev : ref_next(prev);
+    if (!equal_leap_date(ref, date)) {
+      report(check, day_off, "leap_abs_date", ref, date);
+      ++failures;
+    }
+    const int abs = leap_abs_from(date.year, date.month, date.day);
+    if (abs != day_off) {
+      report(check, day_off, "leap_abs_from", date, leap_abs_date(abs));
+      ++failures;
+    }
+    if (day_off == last) {
+      break;
+    }
+    prev = ref;
+  }
+  return failures;
+}
+
+static unsigned long check_ref(struct check *check, int first, int last) {
+  unsigned long failures = 0;
+  /*
+   * Sample the reference decoder at the start of every 4,096-day stride and
+   * at the end of the range; check_abs() already walks every day in between
+   * using the reference month lengths.
+   */
+  for (int day_off = first;; day_off += 4096) {
+    if (day_off > last) {
+      day_off = last;
+    }
+    const struct leap_date ref = ref_abs_date(day_off);
+    const struct leap_date date = leap_abs_date(day_off);
+    if (!equal_leap_date(ref, date)) {
+      report(check, day_off, "reference", ref, date);
+      ++failures;
+    }
+    if (day_off == last) {
+      break;
+    }
+  }
+  return failures;
+}
+
+/*
+ * Checks the closed-form decoders directly. They back the library in some
+ * build modes and its fast paths in all modes.
+ */
+static unsigned long check_cal(struct check *check, int first, int last) {
+  unsigned long failures = 0;
+  for (int day_off = first;; ++day_off) {
+    const struct leap_date date = leap_abs_date(day_off);
+    const struct leap_date cal = leap_cal_date(day_off);
+    if (!equal_leap_date(date, cal)) {
+      report(check, day_off, "leap_cal_date", date, cal);
+      ++failures;
+    }
+    const struct leap_off off = leap_cal_off(day_off);
+    if (off.year != date.year || leap_day(off.year) + off.day != day_off) {
+      report(check, day_off, "leap_cal_off", date, leap_date(off.year, off.day));
+      ++failures;
+    }
+    const struct leap_year_month ym = leap_abs_year_month(day_off);
+    if (leap_abs_year(day_off) != date.year || ym.year != date.year || ym.month != date.month) {
+      report(check, day_off, "leap_abs_year_month", date, (struct leap_date){ym.year, ym.month, date.day});
+      ++failures;
+    }
+    if (leap_cal_from(date.year, date.month, date.day) != day_off ||
+        leap_cal_mday(date.year, date.month) != leap_mday(date.year, date.month)) {
+      report(check, day_off, "leap_cal_from", date, leap_cal_date(leap_cal_from(date.year, date.month, date.day)));
+      ++failures;
+    }
+    if (day_off == last) {
+      break;
+    }
+  }
+  return failures;
+}
+
+/*
+ * Checks timestamp conversion. Picks a different second of each day so that
+ * the sweep visits every time of day many times over, and converts through
+ * nanoseconds wherever 64 bits hold them.
+ */
+static unsigned long check_time(struct check *check, int first, int last) {
+  unsigned long failures = 0;
+  for (int day_off = first;; ++day_off) {
+    const int sod = (int)((unsigned)day_off * 2654435761U % 86400U);
+    const int64_t sec = (int64_t)(day_off - LEAP_MCMLXX) * 86400 + sod;
+    const struct leap_time time = leap_time(sec, LEAP_MCMLXX);
+    const struct leap_date date = leap_abs_date(day_off);
+    if (!equal_leap_date(date, time.date) || time.hour * 3600 + time.min * 60 + time.sec != sod ||
+        leap_time_from(time, LEAP_MCMLXX) != sec) {
+      report(check, day_off, "leap_time", date, time.date);
+      ++failures;
+    }
+    if (sec > INT64_MIN / 1000000000 && sec < INT64_MAX / 1000000000) {
+      const int64_t ns = sec * 1000000000 + sod;
+      const struct leap_time ns_time = leap_time_ns(ns, LEAP_MCMLXX);
+      if (!equal_leap_date(date, ns_time.date) || ns_time.subsec != sod ||
+          leap_time_from_ns(ns_time, LEAP_MCMLXX) != ns) {
+        report(check, day_off, "leap_time_ns", date, ns_time.date);
+        ++failures;
+      }
+    }
+    if (day_off == last) {
+      break;
+    }
+  }
+  return failures;
+}
+
+/*
+ * Checks the batch nanosecond decoder against the single-timestamp decoder,
+ * one day at a time, visiting a different nanosecond of each day.
+ */
+static unsigned long check_time_ns_n(struct check *check, int first, int last) {
+  unsigned long failures = 0;
+  enum { BATCH = 1024 };
+  int64_t ns[BATCH];
+  int year[BATCH], month[BATCH], day[BATCH], hour[BATCH], min[BATCH], sec[BATCH], nsec[BATCH];
+  const struct leap_time_cols cols = {year, month, day, hour, min, sec, nsec};
+  for (long long batch = first; batch <= last; batch += BATCH) {
+    int n = 0;
+    for (long long day_off = batch; day_off <= last && n < BATCH; ++day_off) {
+      const int64_t days = day_off - LEAP_MCMLXX;
+      if (days <= INT64_MIN / 86400000000000 || days >= INT64_MAX / 86400000000000) {
+        continue;
+      }
+      ns[n++] = days * 86400000000000 + (int64_t)((uint64_t)day_off * 11400714819323198485U % 86400000000000U);
+    }
+    leap_time_ns_n(ns, (size_t)n, LEAP_MCMLXX, &cols);
+    for (int i = 0; i < n; ++i) {
+      const struct leap_time want = leap_time_ns(ns[i], LEAP_MCMLXX);
+      const struct leap_time got = {{year[i], month[i], day[i]}, hour[i], min[i], sec[i], nsec[i]};
+      if (!equal_leap_time(want, got)) {
+        report(check, leap_abs_from_date(want.date), "leap_time_ns_n", want.date, got.date);
+        ++failures;
+      }
+    }
+  }
+  return failures;
+}
+
+/*
+ * Checks weekdays against the reference floored modulus, from absolute days,
+ * from dates and in batches.
+ */
+static unsigned long check_wday(struct check *check, int first, int last) {
+  unsigned long failures = 0;
+  enum { BATCH = 1024 };
+  int abs_day[BATCH], wday[BATCH];
+  for (long long batch = first; batch <= last; batch += BATCH) {
+    int n = 0;
+    for (long long day_off = batch; day_off <= last && n < BATCH; ++day_off) {
+      abs_day[n++] = (int)day_off;
+    }
+    leap_wday_n(abs_day, (size_t)n, wday);
+    for (int i = 0; i < n; ++i) {
+      const int want = abs_day[i] + 6 - 7 * ref_quo(abs_day[i] + 6, 7);
+      const struct leap_date date = leap_abs_date(abs_day[i]);
+      if (leap_wday(abs_day[i]) != want || leap_wday_from(date.year, date.month, date.day) != want || wday[i] != want) {
+        report(check, abs_day[i], "leap_wday", date, date);
+        ++failures;
+      }
+    }
+  }
+  return failures;
+}
+
+/*
+ * Checks ISO week dates: each round-trips, and successive days advance the
+ * weekday, rolling over into the next week or the next ISO year's week 1
+ * after Sunday. The ISO year never strays from the Thursday's calendar year.
+ */
+static unsigned long check_iso(struct check *check, int first, int last) {
+  unsigned long failures = 0;
+  struct leap_iso prev = leap_iso_week(first - 1);
+  for (int day_off = first;; ++day_off) {
+    const struct leap_iso iso = leap_iso_week(day_off);
+    const struct leap_date thu = ref_abs_date(day_off - iso.wday + 4);
+    const bool next = prev.wday < 7 ? iso.year == prev.year && iso.week == prev.week && iso.wday == prev.wday + 1
+                                    : iso.wday == 1 && ((iso.year == prev.year && iso.week == prev.week + 1) ||
+                                                        (iso.year == prev.year + 1 && iso.week == 1));
+    if (!next || leap_iso_from_iso(iso) != day_off || iso.year != thu.year) {
+      report(check, day_off, "leap_iso_week", thu, (struct leap_date){iso.year, iso.week, iso.wday});
+      ++failures;
+    }
+    prev = iso;
+    if (day_off == last) {
+      break;
+    }
+  }
+  return failures;
+}
+
+/*
+ * Checks month addition against the reference month lengths, one month
+ * forward and back under every end-of-month policy.
+ */
+static unsigned long check_month(struct check *check, int first, int last) {
+  unsigned long failures = 0;
+  for (int day_off = first;; ++day_off) {
+    const struct leap_date date = ref_abs_date(day_off);
+    const bool end = date.day == ref_mday(date.year, date.month);
+    for (int months = -1; months <= 1; months += 2) {
+      const int year = date.year + (date.month + months > 12) - (date.month + months < 1);
+      const int month = date.month + months - 12 * (date.month + months > 12) + 12 * (date.month + months < 1);
+      const int mday = ref_mday(year, month);
+      const struct leap_date clamp = {year, month, date.day < mday ? date.day : mday};
+      const struct leap_date want[] = {
+          clamp,
+          date.day > mday ? (struct leap_date){year, month + 1, date.day - mday} : clamp,
+          {year, month, end ? mday : clamp.day},
+      };
+      const enum leap_eom eom[] = {LEAP_EOM_CLAMP, LEAP_EOM_OVERFLOW, LEAP_EOM_STICK};
+      for (int i = 0; i < 3; ++i) {
+        const struct leap_date got = leap_add_months(date, months, eom[i]);
+        if (!equal_leap_date(want[i], got)) {
+          report(check, day_off, "leap_add_months", want[i], got);
+          ++failures;
+        }
+      }
+    }
+    if (day_off == last) {
+      break;
+    }
+  }
+  return failures;
+}
+
+/*
+ * Checks truncation: every day truncates to a day no later whose reference
+ * date starts the bucket, and the truncated day is the same for every day
+ * until the next bucket starts.
+ */
+static unsigned long check_trunc(struct check *check, int first, int last) {
+  unsigned long failures = 0;
+  int prev[LEAP_UNIT_YEAR + 1];
+  for (enum leap_unit unit = LEAP_UNIT_DAY; unit <= LEAP_UNIT_YEAR; ++unit) {
+    prev[unit] = leap_trunc(first - 1, unit);
+  }
+  for (int day_off = first;; ++day_off) {
+    const struct leap_date date = ref_abs_date(day_off);
+    const int wday = day_off + 5 - 7 * ref_quo(day_off + 5, 7);
+    const bool starts[] = {
+        true,
+        wday == 0,
+        date.day == 1,
+        date.day == 1 && (date.month == 1 || date.month == 4 || date.month == 7 || date.month == 10),
+        date.day == 1 && date.month == 1,
+    };
+    for (enum leap_unit unit = LEAP_UNIT_DAY; unit <= LEAP_UNIT_YEAR; ++unit) {
+      const int want = starts[unit] ? day_off : prev[unit];
+      const int got = leap_trunc(day_off, unit);
+      if (got != want) {
+        report(check, day_off, "leap_trunc", ref_abs_date(want), ref_abs_date(got));
+        ++failures;
+      }
+      prev[unit] = got;
+    }
+    if (day_off == last) {
+      break;
+    }
+  }
+  return failures;
+}
+
+/*
+ * Checks the date parsers on every date with a four-digit year, in every
+ * form, and the date formatter against printf. Skips days outside years 0000
+ * through 9999.
+ */
+static unsigned long check_parse(struct check *check, int first, int last) {
+  unsigned long failures = 0;
+  const int lo = first > 0 ? first : 0;
+  const int hi = last < 3652424 ? last : 3652424;
+  for (int day_off = lo; day_off <= hi; ++day_off) {
+    const struct leap_date date = ref_abs_date(day_off);
+    char text[3][48];
+    (void)snprintf(text[0], sizeof(text[0]), "%04d-%02d-%02d", date.year, date.month, date.day);
+    (void)snprintf(text[1], sizeof(text[1]), "%04d%02d%02d", date.year, date.month, date.day);
+    (void)snprintf(text[2], sizeof(text[2]), "%04d-%03d", date.year, day_off - ref_day(date.year) + 1);
+    char iso[LEAP_FORMAT_ISO];
+    leap_format_iso(day_off, iso);
+    if (memcmp(iso, text[0], sizeof(iso)) != 0) {
+      report(check, day_off, "leap_format_iso", date, date);
+      ++failures;
+    }
+    for (enum leap_iso_date form = LEAP_ISO_DATE_EXTENDED; form <= LEAP_ISO_DATE_ORDINAL; ++form) {
+      int got = -1;
+      if (!leap_parse_iso_date(text[form], form, &got) || got != day_off) {
+        report(check, day_off, text[form], date, ref_abs_date(got));
+        ++failures;
+      }
+    }
+  }
+  return failures;
+}
+
+/*
+ * Checks date keys both ways. Every key from a day in range converts back to
+ * the day, and the key one past the last day of each month is invalid.
+ */
+static unsigned long check_key(struct check *check, int first, int last) {
+  unsigned long failures = 0;
+  for (int day_off = first;; ++day_off) {
+    const struct leap_date date = ref_abs_date(day_off);
+    const bool in = day_off >= 0 && day_off <= LEAP_YMD_KEY_ABS_MAX;
+    const int32_t want = in ? date.year * 10000 + date.month * 100 + date.day : -1;
+    const int32_t key = leap_abs_to_ymd_key(day_off);
+    int got = -1;
+    if (key != want) {
+      report(check, day_off, "leap_abs_to_ymd_key", date, date);
+      ++failures;
+    } else if (in && (!leap_ymd_key_to_abs(key, &got) || got != day_off)) {
+      report(check, day_off, "leap_ymd_key_to_abs", date, ref_abs_date(got));
+      ++failures;
+    } else if (in && date.day == ref_mday(date.year, date.month) && leap_ymd_key_to_abs(key + 1, &got)) {
+      report(check, day_off, "leap_ymd_key_to_abs past month end", date, ref_abs_date(got));
+      ++failures;
+    }
+    if (day_off == last) {
+      break;
+    }
+  }
+  return failures;
+}
+
+/*
+ * Checks packed dates: every day in range packs to its date, unpacks to
+ * itself and packs above the day before.
+ */
+static unsigned long check_pack(struct check *check, int first, int last) {
+  unsigned long failures = 0;
+  const int lo = first > LEAP_PACK_ABS_MIN ? first : LEAP_PACK_ABS_MIN;
+  const int hi = last < LEAP_PACK_ABS_MAX ? last : LEAP_PACK_ABS_MAX;
+  uint32_t prev = lo > LEAP_PACK_ABS_MIN ? leap_abs_pack(lo - 1) : 0;
+  for (int day_off = lo; day_off <= hi; ++day_off) {
+    const struct leap_date date = ref_abs_date(day_off);
+    const uint32_t packed = leap_abs_pack(day_off);
+    if (!equal_leap_date(date, leap_unpack(packed)) || packed <= prev) {
+      report(check, day_off, "leap_abs_pack", date, leap_unpack(packed));
+      ++failures;
+    } else if (leap_pack_abs(packed) != day_off) {
+      report(check, day_off, "leap_pack_abs", date, ref_abs_date(leap_pack_abs(packed)));
+      ++failures;
+    }
+    prev = packed;
+  }
+  return failures;
+}
+
+static struct check checks[] = {
+    {.name = "abs", .run = check_abs},
+    {.name = "ref", .run = check_ref},
+    {.name = "cal", .run = check_cal},
+    {.name = "time", .run = check_time},
+    {.name = "time_ns_n", .run = check_time_ns_n},
+    {.name = "wday", .run = check_wday},
+    {.name = "iso", .run = check_iso},
+    {.name = "month", .run = check_month},
+    {.name = "trunc", .run = check_trunc},
+    {.name = "parse", .run = check_parse},
+    {.name = "key", .run = check_key},
+    {.name = "pack", .run = check_pack},
+};
+
+#define NUM_CHECKS (sizeof(checks) / sizeof(checks[0]))
+
+/*!
+ * \brief Shared sweep state.
+ * \details Workers claim chunks by atomically incrementing the next chunk
+ * number.
+ */
+struct sweep {
+  long long first;
+  long long last;
+  atomic_llong next;
+};
+
+static void *worker(void *arg) {
+  struct sweep *sweep = arg;
+  for (;;) {
+    const long long chunk = atomic_fetch_add(&sweep->next, 1);
+    const long long first = sweep->first + chunk * CHUNK_DAYS;
+    if (first > sweep->last) {
+      break;
+    }
+    long long last = first + CHUNK_DAYS - 1;
+    if (last > sweep->last) {
+      last = sweep->last;
+    }
+    for (size_t i = 0; i < NUM_CHECKS; ++i) {
+      atomic_fetch_add(&checks[i].failures, checks[i].run(&checks[i], (int)first, (int)last));
+    }
+  }
+  return NULL;
+}
+
+int main(int argc, char **argv) {
+  long threads = sysconf(_SC_NPROCESSORS_ONLN);
+  struct sweep sweep = {.first = LEAP_ABS_MIN, .last = LEAP_ABS_MAX};
+  /*
+   * Parse arguments by hand rather than using getopt() because the range
+   * arguments can be negative and would otherwise look like options.
+   */
+  long long range[2];
+  int ranges = 0;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+      threads = strtol(argv[++i], NULL, 10);
+    } else if (ranges < 2) {
+      range[ranges++] = strtoll(argv[i], NULL, 10);
+    } else {
+      ranges = -1;
+      break;
+    }
+  }
+  if (ranges == 2) {
+    sweep.first = range[0];
+    sweep.last = range[1];
+  } else if (ranges != 0) {
+    (void)fprintf(stderr, "usage: %s [-j threads] [first last]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  if (sweep.first < LEAP_ABS_MIN || sweep.last > LEAP_ABS_MAX || sweep.first > sweep.last) {
+    (void)fprintf(stderr, "range must lie within %d through %d\n", LEAP_ABS_MIN, LEAP_ABS_MAX);
+    return EXIT_FAILURE;
+  }
+  if (threads < 1) {
+    threads = 1;
+  }
+  atomic_init(&sweep.next, 0);
+
+  pthread_t *tids = calloc((size_t)threads, sizeof(*tids));
+  if (tids == NULL) {
+    return EXIT_FAILURE;
+  }
+  /*
+   * A verifier must not pass on partial coverage. If a thread fails to start,
+   * join those that did and fail.
+   */
+  long started = 0;
+  int err = 0;
+  while (started < threads && (err = pthread_create(&tids[started], NULL, worker, &sweep)) == 0) {
+    ++started;
+  }
+  for (long i = 0; i < started; ++i) {
+    (void)pthread_join(tids[i], NULL);
+  }
+  free(tids);
+  if (err != 0) {
+    (void)fprintf(stderr, "pthread_create: %s\n", strerror(err));
+    return EXIT_FAILURE;
+  }
+
+  unsigned long failures = 0;
+  for (size_t i = 0; i < NUM_CHECKS; ++i) {
+    const unsigned long check_failures = atomic_load(&checks[i].failures);
+    (void)printf("%s: %lu failures\n", checks[i].name, check_failures);
+    failures += check_failures;
+  }
+  (void)printf("%lld days from %lld through %lld on %ld threads\n", sweep.last - sweep.first + 1, sweep.first,
+               sweep.last, threads);
+  return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,400 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file leapc_convert.c
+ * \brief Converts binary date columns to calendar field columns.
+ * \details Maps a binary file of days or timestamps since 1970 into memory and
+ * writes one binary column per calendar field: years, months, days of the
+ * month and weekdays (0 for Sunday), each a native-endian 32-bit integer per
+ * input value. Writes each output through a shared writable mapping by
+ * default, so that the conversion stores straight into the page cache with no
+ * copy in user space; \c -w writes large sequential blocks instead.
+ *
+ * Converts in blocks: input values to absolute days, days to packed dates by
+ * leap_abs_pack_n() and weekdays by leap_wday_n(), both of which vectorise,
+ * then unpacks the fields wanted. Reports the bytes read and written per
+ * second on standard error.
+ *
+ * Usage:
+ * \code
+ * leapc-convert [-t type] [-c columns] [-w] [-s] [-v] input prefix
+ * leapc-convert [-t type] -g count input
+ * \endcode
+ * Types are \c d32 and \c d64 for 32- and 64-bit days, \c s, \c ms, \c us and
+ * \c ns for 64-bit timestamps; \c d32 by default. Columns are a
+ * comma-separated selection from \c year, \c month, \c day and \c wday; all by
+ * default. Outputs go to files named after the prefix and the column, for
+ * example \c prefix.year. Option \c -s advises the kernel with
+ * \c MADV_SEQUENTIAL; \c -v checks every output against leap_abs_date();
+ * \c -g generates an ascending sample input for benchmarking.
+ * \copyright 2025, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+
+#define _DEFAULT_SOURCE
+
+#include "leap.h"
+#include "leap_pack.h"
+#include "leap_wday.h"
+
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+_Static_assert(sizeof(int) == 4, "output columns hold 32-bit int fields");
+
+/*!
+ * \brief Values per conversion block.
+ */
+#define BLOCK 16384
+
+enum type { D32, D64, SEC, MS, US, NS, TYPES };
+
+static const char *const TYPE_NAME[TYPES] = {"d32", "d64", "s", "ms", "us", "ns"};
+
+static const int64_t PER_DAY[TYPES] = {
+    1, 1, INT64_C(86400), INT64_C(86400000), INT64_C(86400000000), INT64_C(86400000000000),
+};
+
+enum column { YEAR, MONTH, DAY, WDAY, COLUMNS };
+
+static const char *const COLUMN_NAME[COLUMNS] = {"year", "month", "day", "wday"};
+
+/*
+ * One output column: its file, and either its mapping or its block buffer.
+ */
+struct output {
+  bool on;
+  int fd;
+  int *map;
+  int *buf;
+};
+
+static double now(void) {
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/*
+ * Floors 64-bit values to days since 1970 by a constant divisor, one loop per
+ * unit so that each divides by a constant.
+ */
+#define DAYS(k)                                                                                                        \
+  for (size_t j = 0; j < m; ++j) {                                                                                     \
+    const int64_t v = in64[j];                                                                                         \
+    since[j] = v / (k) - (v % (k) < 0);                                                                                \
+  }
+
+/*
+ * Converts a block of input values to absolute days, answering false if any
+ * falls outside the years that pack.
+ */
+static bool days_of(const void *in, enum type type, size_t m, int *day) {
+  int64_t since[BLOCK];
+  const int64_t *in64 = in;
+  switch (type) {
+  case D32:
+    for (size_t j = 0; j < m; ++j) {
+      since[j] = ((const int32_t *)in)[j];
+    }
+    break;
+  case D64:
+    for (size_t j = 0; j < m; ++j) {
+      since[j] = in64[j];
+    }
+    break;
+  case SEC:
+    DAYS(INT64_C(86400));
+    break;
+  case MS:
+    DAYS(INT64_C(86400000));
+    break;
+  case US:
+    DAYS(INT64_C(86400000000));
+    break;
+  default:
+    DAYS(INT64_C(86400000000000));
+  }
+  bool ok = true;
+  for (size_t j = 0; j < m; ++j) {
+    bool in = since[j] >= LEAP_PACK_ABS_MIN - LEAP_MCMLXX && since[j] <= LEAP_PACK_ABS_MAX - LEAP_MCMLXX;
+    day[j] = in ? LEAP_MCMLXX + (int)since[j] : LEAP_MCMLXX;
+    ok &= in;
+  }
+  return ok;
+}
+
+static void convert(const int *day, size_t m, int *const *col) {
+  uint32_t packed[BLOCK];
+  leap_abs_pack_n(day, m, packed);
+  if (col[YEAR] != NULL) {
+    for (size_t j = 0; j < m; ++j) {
+      col[YEAR][j] = leap_unpack(packed[j]).year;
+    }
+  }
+  if (col[MONTH] != NULL) {
+    for (size_t j = 0; j < m; ++j) {
+      col[MONTH][j] = leap_unpack(packed[j]).month;
+    }
+  }
+  if (col[DAY] != NULL) {
+    for (size_t j = 0; j < m; ++j) {
+      col[DAY][j] = leap_unpack(packed[j]).day;
+    }
+  }
+  if (col[WDAY] != NULL) {
+    leap_wday_n(day, m, col[WDAY]);
+  }
+}
+
+static bool write_all(int fd, const void *buf, size_t size) {
+  for (const char *at = buf; size > 0;) {
+    const ssize_t done = write(fd, at, size);
+    if (done < 0) {
+      return false;
+    }
+    at += done;
+    size -= (size_t)done;
+  }
+  return true;
+}
+
+/*
+ * Writes an ascending sample: 1024 values a day from 2020 onwards.
+ */
+static int generate(const char *path, enum type type, size_t count) {
+  FILE *file = fopen(path, "wb");
+  if (file == NULL) {
+    perror(path);
+    return EXIT_FAILURE;
+  }
+  const int64_t per_day = PER_DAY[type];
+  const int64_t first = leap_abs_from(2020, 1, 1) - LEAP_MCMLXX;
+  for (size_t i = 0; i < count; ++i) {
+    const int64_t day = first + (int64_t)(i >> 10);
+    const int64_t value = type <= D64 ? day : day * per_day + (int64_t)(i & 1023) * (per_day >> 10);
+    const int32_t value32 = (int32_t)value;
+    if (fwrite(type == D32 ? (const void *)&value32 : (const void *)&value, type == D32 ? 4 : 8, 1, file) != 1) {
+      perror(path);
+      (void)fclose(file);
+      return EXIT_FAILURE;
+    }
+  }
+  return fclose(file) == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*
+ * Maps each output file back and checks every field against leap_abs_date().
+ */
+static bool verify(const void *in, enum type type, size_t n, const char *prefix, const struct output *out) {
+  const int *map[COLUMNS] = {NULL};
+  bool ok = true;
+  for (int k = 0; k < COLUMNS; ++k) {
+    if (!out[k].on || n == 0) {
+      continue;
+    }
+    char path[4096];
+    (void)snprintf(path, sizeof(path), "%s.%s", prefix, COLUMN_NAME[k]);
+    const int fd = open(path, O_RDONLY);
+    map[k] = fd < 0 ? MAP_FAILED : mmap(NULL, n * sizeof(int), PROT_READ, MAP_SHARED, fd, 0);
+    if (fd >= 0) {
+      (void)close(fd);
+    }
+    if (map[k] == MAP_FAILED) {
+      perror(path);
+      map[k] = NULL;
+      ok = false;
+    }
+  }
+  const size_t size = type == D32 ? 4 : 8;
+  for (size_t i = 0; ok && i < n; i += BLOCK) {
+    const size_t m = n - i < BLOCK ? n - i : BLOCK;
+    int day[BLOCK];
+    (void)days_of((const char *)in + i * size, type, m, day);
+    for (size_t j = 0; ok && j < m; ++j) {
+      const struct leap_date date = leap_abs_date(day[j]);
+      const int want[COLUMNS] = {date.year, date.month, date.day, leap_wday(day[j])};
+      for (int k = 0; k < COLUMNS; ++k) {
+        if (map[k] != NULL && map[k][i + j] != want[k]) {
+          (void)fprintf(stderr, "value %zu: %s %d, want %d\n", i + j, COLUMN_NAME[k], map[k][i + j], want[k]);
+          ok = false;
+        }
+      }
+    }
+  }
+  for (int k = 0; k < COLUMNS; ++k) {
+    if (map[k] != NULL) {
+      (void)munmap((void *)map[k], n * sizeof(int));
+    }
+  }
+  return ok;
+}
+
+static int usage(const char *name) {
+  (void)fprintf(stderr,
+                "usage: %s [-t d32|d64|s|ms|us|ns] [-c year,month,day,wday] [-w] [-s] [-v] input prefix\n"
+                "       %s [-t type] -g count input\n",
+                name, name);
+  return EXIT_FAILURE;
+}
+
+int main(int argc, char **argv) {
+  enum type type = D32;
+  struct output out[COLUMNS] = {{true, -1, NULL, NULL}, {true, -1, NULL, NULL}, {true, -1, NULL, NULL},
+                                {true, -1, NULL, NULL}};
+  bool by_write = false, sequential = false, check = false;
+  long long count = -1;
+  int opt;
+  while ((opt = getopt(argc, argv, "t:c:wsvg:")) != -1) {
+    switch (opt) {
+    case 't':
+      for (type = 0; type < TYPES && strcmp(optarg, TYPE_NAME[type]) != 0; ++type) {
+      }
+      if (type == TYPES) {
+        return usage(argv[0]);
+      }
+      break;
+    case 'c':
+      for (int k = 0; k < COLUMNS; ++k) {
+        out[k].on = false;
+      }
+      for (char *name = strtok(optarg, ","); name != NULL; name = strtok(NULL, ",")) {
+        int k = 0;
+        while (k < COLUMNS && strcmp(name, COLUMN_NAME[k]) != 0) {
+          ++k;
+        }
+        if (k == COLUMNS) {
+          return usage(argv[0]);
+        }
+        out[k].on = true;
+      }
+      break;
+    case 'w':
+      by_write = true;
+      break;
+    case 's':
+      sequential = true;
+      break;
+    case 'v':
+      check = true;
+      break;
+    case 'g':
+      count = strtoll(optarg, NULL, 10);
+      break;
+    default:
+      return usage(argv[0]);
+    }
+  }
+  if (count >= 0) {
+    return optind + 1 == argc ? generate(argv[optind], type, (size_t)count) : usage(argv[0]);
+  }
+  if (optind + 2 != argc) {
+    return usage(argv[0]);
+  }
+  const char *input = argv[optind], *prefix = argv[optind + 1];
+
+  const int in_fd = open(input, O_RDONLY);
+  struct stat st;
+  if (in_fd < 0 || fstat(in_fd, &st) != 0) {
+    perror(input);
+    return EXIT_FAILURE;
+  }
+  const size_t size = type == D32 ? 4 : 8;
+  if ((size_t)st.st_size % size != 0) {
+    (void)fprintf(stderr, "%s: size not a multiple of %zu bytes\n", input, size);
+    return EXIT_FAILURE;
+  }
+  const size_t n = (size_t)st.st_size / size;
+  const void *in = NULL;
+  if (n > 0) {
+    in = mmap(NULL, n * size, PROT_READ, MAP_PRIVATE, in_fd, 0);
+    if (in == MAP_FAILED) {
+      perror(input);
+      return EXIT_FAILURE;
+    }
+    if (sequential) {
+      (void)madvise((void *)in, n * size, MADV_SEQUENTIAL);
+    }
+  }
+  (void)close(in_fd);
+
+  size_t columns = 0;
+  for (int k = 0; k < COLUMNS; ++k) {
+    if (!out[k].on) {
+      continue;
+    }
+    ++columns;
+    char path[4096];
+    (void)snprintf(path, sizeof(path), "%s.%s", prefix, COLUMN_NAME[k]);
+    out[k].fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (out[k].fd < 0) {
+      perror(path);
+      return EXIT_FAILURE;
+    }
+    if (by_write) {
+      out[k].buf = malloc(BLOCK * sizeof(int));
+      if (out[k].buf == NULL) {
+        perror("malloc");
+        return EXIT_FAILURE;
+      }
+    } else if (n > 0) {
+      if (ftruncate(out[k].fd, (off_t)(n * sizeof(int))) != 0 ||
+          (out[k].map = mmap(NULL, n * sizeof(int), PROT_READ | PROT_WRITE, MAP_SHARED, out[k].fd, 0)) ==
+              MAP_FAILED) {
+        perror(path);
+        return EXIT_FAILURE;
+      }
+      if (sequential) {
+        (void)madvise(out[k].map, n * sizeof(int), MADV_SEQUENTIAL);
+      }
+    }
+  }
+
+  const double start = now();
+  for (size_t i = 0; i < n; i += BLOCK) {
+    const size_t m = n - i < BLOCK ? n - i : BLOCK;
+    int day[BLOCK];
+    if (!days_of((const char *)in + i * size, type, m, day)) {
+      (void)fprintf(stderr, "%s: values from %zu fall outside years %d through %d\n", input, i, LEAP_PACK_YEAR_MIN,
+                    LEAP_PACK_YEAR_MAX);
+      return EXIT_FAILURE;
+    }
+    int *col[COLUMNS];
+    for (int k = 0; k < COLUMNS; ++k) {
+      col[k] = !out[k].on ? NULL : by_write ? out[k].buf : out[k].map + i;
+    }
+    convert(day, m, col);
+    for (int k = 0; k < COLUMNS; ++k) {
+      if (by_write && out[k].on && !write_all(out[k].fd, out[k].buf, m * sizeof(int))) {
+        perror(COLUMN_NAME[k]);
+        return EXIT_FAILURE;
+      }
+    }
+  }
+  for (int k = 0; k < COLUMNS; ++k) {
+    if (out[k].map != NULL) {
+      (void)munmap(out[k].map, n * sizeof(int));
+    }
+    free(out[k].buf);
+    if (out[k].fd >= 0 && close(out[k].fd) != 0) {
+      perror(COLUMN_NAME[k]);
+      return EXIT_FAILURE;
+    }
+  }
+  const double elapsed = now() - start;
+  const double bytes = (double)n * (double)(size + columns * sizeof(int));
+  (void)fprintf(stderr, "%zu values, %.0f bytes in %.3f s: %.2f GB/s\n", n, bytes, elapsed,
+                elapsed > 0 ? bytes / elapsed * 1e-9 : 0.0);
+
+  const bool ok = !check || verify(in, type, n, prefix, out);
+  if (in != NULL) {
+    (void)munmap((void *)in, n * size);
+  }
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}